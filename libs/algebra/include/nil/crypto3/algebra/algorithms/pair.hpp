@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <utility>
+#include <vector>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -53,6 +56,26 @@ namespace nil {
             //     return PairingCurveType::pairing::affine_ate_miller_loop(prec_P, prec_Q);
             // }
 
+            namespace detail {
+                template<typename PairingCurveType, typename PairingPolicy, typename InputIterator>
+                auto multi_miller_loop_impl(InputIterator first, InputIterator last, int)
+                    -> decltype(PairingPolicy::multi_miller_loop::process(first, last)) {
+                    return PairingPolicy::multi_miller_loop::process(first, last);
+                }
+
+                /// Policies without a dedicated multi Miller loop fall back to the product of single loops
+                template<typename PairingCurveType, typename PairingPolicy, typename InputIterator>
+                typename PairingCurveType::gt_type::value_type multi_miller_loop_impl(InputIterator first,
+                                                                                     InputIterator last, long) {
+                    typename PairingCurveType::gt_type::value_type f =
+                        PairingCurveType::gt_type::value_type::one();
+                    for (; first != last; ++first) {
+                        f = f * PairingPolicy::miller_loop::process(first->first, first->second);
+                    }
+                    return f;
+                }
+            }    // namespace detail
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingPolicy::g1_precomputed_type
             precompute_g1(const typename PairingCurveType::template g1_type<>::value_type &P) {
@@ -105,6 +128,38 @@ namespace nil {
                 return PairingPolicy::double_miller_loop::process(prec_P1, prec_Q1, prec_P2, prec_Q2);
             }
 
+            /*!
+             * @brief Product of the Miller loops of the precomputed pairs in [first, last), the value type of the
+             * range being std::pair<g1_precomputed_type, g2_precomputed_type>. All the pairs share the squarings
+             * of the accumulator.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputIterator>
+            typename PairingCurveType::gt_type::value_type
+            multi_miller_loop(InputIterator first, InputIterator last) {
+                return detail::multi_miller_loop_impl<PairingCurveType, PairingPolicy>(first, last, 0);
+            }
+
+            /*!
+             * @brief Product of the reduced pairings of the (g1, g2) pairs in [first, last), computed with a single
+             * multi Miller loop and a single final exponentiation.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputIterator>
+            typename PairingCurveType::gt_type::value_type
+            multi_pair_reduced(InputIterator first, InputIterator last) {
+                std::vector<std::pair<typename PairingPolicy::g1_precomputed_type,
+                                      typename PairingPolicy::g2_precomputed_type>>
+                    precomputed;
+                for (; first != last; ++first) {
+                    precomputed.emplace_back(PairingPolicy::precompute_g1::process(first->first),
+                                             PairingPolicy::precompute_g2::process(first->second));
+                }
+
+                return PairingPolicy::final_exponentiation::process(
+                    multi_miller_loop<PairingCurveType, PairingPolicy>(precomputed.begin(), precomputed.end()));
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
             final_exponentiation(const typename PairingCurveType::gt_type::value_type &elt) {
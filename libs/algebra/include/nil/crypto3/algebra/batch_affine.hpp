@@ -0,0 +1,207 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
+
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/batch_inversion.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Recovers affine coordinates of a short Weierstrass point from its projective-like
+                     *  coordinates given an already computed inverse of Z.
+                     *  @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename Coordinates>
+                    struct short_weierstrass_affine_normalization;
+
+                    // x = X/Z^2, y = Y/Z^3
+                    struct short_weierstrass_jacobian_affine_normalization {
+                        template<typename FieldValueType>
+                        static void process(FieldValueType &X, FieldValueType &Y, const FieldValueType &Z_inversed) {
+                            FieldValueType Z_inversed_squared = Z_inversed.squared();
+                            X *= Z_inversed_squared;
+                            Y *= Z_inversed_squared * Z_inversed;
+                        }
+                    };
+
+                    // x = X/Z, y = Y/Z
+                    struct short_weierstrass_projective_affine_normalization {
+                        template<typename FieldValueType>
+                        static void process(FieldValueType &X, FieldValueType &Y, const FieldValueType &Z_inversed) {
+                            X *= Z_inversed;
+                            Y *= Z_inversed;
+                        }
+                    };
+
+                    template<>
+                    struct short_weierstrass_affine_normalization<coordinates::jacobian>
+                        : public short_weierstrass_jacobian_affine_normalization { };
+
+                    template<>
+                    struct short_weierstrass_affine_normalization<coordinates::jacobian_with_a4_0>
+                        : public short_weierstrass_jacobian_affine_normalization { };
+
+                    template<>
+                    struct short_weierstrass_affine_normalization<coordinates::jacobian_with_a4_minus_3>
+                        : public short_weierstrass_jacobian_affine_normalization { };
+
+                    template<>
+                    struct short_weierstrass_affine_normalization<coordinates::projective>
+                        : public short_weierstrass_projective_affine_normalization { };
+
+                    template<>
+                    struct short_weierstrass_affine_normalization<coordinates::projective_with_a4_minus_3>
+                        : public short_weierstrass_projective_affine_normalization { };
+                }    // namespace detail
+            }        // namespace curves
+
+            /** @brief Converts short Weierstrass points from jacobian or projective coordinates to affine
+             *  coordinates with a single field inversion.
+             *  @return affine points, the point at infinity is mapped to the affine zero
+             */
+            template<typename CurveElementType>
+            std::vector<decltype(std::declval<CurveElementType>().to_affine())>
+                batch_to_affine(const std::vector<CurveElementType> &points) {
+
+                typedef decltype(std::declval<CurveElementType>().to_affine()) affine_value_type;
+                typedef typename CurveElementType::field_type::value_type field_value_type;
+                typedef curves::detail::short_weierstrass_affine_normalization<typename CurveElementType::coordinates>
+                    normalization_type;
+
+                std::vector<field_value_type> Z_inversed(points.size());
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    Z_inversed[i] = points[i].Z;
+                }
+                batch_invert(Z_inversed);
+
+                std::vector<affine_value_type> result;
+                result.reserve(points.size());
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (points[i].is_zero()) {
+                        result.emplace_back(affine_value_type::zero());
+                    } else {
+                        field_value_type X = points[i].X, Y = points[i].Y;
+                        normalization_type::process(X, Y, Z_inversed[i]);
+                        result.emplace_back(X, Y);
+                    }
+                }
+
+                return result;
+            }
+
+            /** @brief Brings short Weierstrass points in jacobian or projective coordinates to the special form
+             *  Z = 1 in place with a single field inversion, so that they can be used as the second argument of
+             *  mixed_add. The point at infinity is left untouched.
+             */
+            template<typename CurveElementType>
+            void batch_normalize(std::vector<CurveElementType> &points) {
+
+                typedef typename CurveElementType::field_type::value_type field_value_type;
+                typedef curves::detail::short_weierstrass_affine_normalization<typename CurveElementType::coordinates>
+                    normalization_type;
+
+                std::vector<field_value_type> Z_inversed(points.size());
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    Z_inversed[i] = points[i].Z;
+                }
+                batch_invert(Z_inversed);
+
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (!points[i].is_zero()) {
+                        normalization_type::process(points[i].X, points[i].Y, Z_inversed[i]);
+                        points[i].Z = field_value_type::one();
+                    }
+                }
+            }
+
+            /** @brief Computes points[i] += others[i] for every i for short Weierstrass points in affine
+             *  coordinates, sharing a single field inversion between all the additions (Montgomery's trick).
+             *  Doublings, opposite points and the point at infinity are handled.
+             */
+            template<typename AffineCurveElementType>
+            void batch_affine_add(std::vector<AffineCurveElementType> &points,
+                                  const std::vector<AffineCurveElementType> &others) {
+
+                typedef typename AffineCurveElementType::field_type::value_type field_value_type;
+                typedef typename AffineCurveElementType::params_type params_type;
+
+                BOOST_ASSERT(points.size() == others.size());
+
+                // slope of the line through points[i] and others[i] is numerators[i] / denominators[i],
+                // a zero denominator marks pairs which do not need the slope
+                std::vector<field_value_type> numerators(points.size(), field_value_type::zero());
+                std::vector<field_value_type> denominators(points.size(), field_value_type::zero());
+
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (points[i].is_zero() || others[i].is_zero()) {
+                        continue;
+                    }
+                    if (points[i].X != others[i].X) {
+                        numerators[i] = others[i].Y - points[i].Y;
+                        denominators[i] = others[i].X - points[i].X;
+                    } else if (points[i].Y == others[i].Y && !points[i].Y.is_zero()) {
+                        numerators[i] = points[i].X.squared();
+                        numerators[i] = numerators[i].doubled() + numerators[i] + params_type::a;
+                        denominators[i] = points[i].Y.doubled();
+                    }
+                }
+
+                batch_invert(denominators);
+
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (others[i].is_zero()) {
+                        continue;
+                    }
+                    if (points[i].is_zero()) {
+                        points[i] = others[i];
+                        continue;
+                    }
+                    if (denominators[i].is_zero()) {
+                        // P + (-P)
+                        points[i] = AffineCurveElementType::zero();
+                        continue;
+                    }
+
+                    const field_value_type lambda = numerators[i] * denominators[i];
+                    const field_value_type X3 = lambda.squared() - points[i].X - others[i].X;
+                    points[i].Y = lambda * (points[i].X - X3) - points[i].Y;
+                    points[i].X = X3;
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
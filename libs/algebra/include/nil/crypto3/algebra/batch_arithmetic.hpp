@@ -0,0 +1,112 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_BATCH_ARITHMETIC_HPP
+
+#include <iterator>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                template<typename FieldValueType, typename = void>
+                struct is_word_field_element : std::false_type { };
+
+                // Elements built on fields::detail::element_fp_word expose their word arithmetic policy
+                template<typename FieldValueType>
+                struct is_word_field_element<FieldValueType, std::void_t<typename FieldValueType::arithmetic_type>>
+                    : std::integral_constant<bool, std::is_standard_layout<FieldValueType>::value &&
+                                                       sizeof(FieldValueType) ==
+                                                           sizeof(typename FieldValueType::word_type)> { };
+
+                template<typename FieldValueType>
+                using word_batch_functions =
+                    fields::detail::word_batch_functions<typename FieldValueType::arithmetic_type>;
+
+                template<typename FieldValueType>
+                typename FieldValueType::word_type *word_data(FieldValueType *values) {
+                    return reinterpret_cast<typename FieldValueType::word_type *>(values);
+                }
+
+                template<typename FieldValueType>
+                const typename FieldValueType::word_type *word_data(const FieldValueType *values) {
+                    return reinterpret_cast<const typename FieldValueType::word_type *>(values);
+                }
+            }    // namespace detail
+
+            /** @brief Element-wise sum result[i] = a[i] + b[i] over contiguous ranges of field elements.
+             *  Word-sized fields (Goldilocks, BabyBear) use AVX2/AVX-512 kernels when available,
+             *  other fields fall back to a plain loop. result may alias a or b.
+             */
+            template<typename Range>
+            void batch_add(Range &result, const Range &a, const Range &b) {
+                typedef typename std::remove_cv<typename std::remove_reference<decltype(*std::data(a))>::type>::type
+                    value_type;
+
+                const std::size_t size = std::size(a);
+                BOOST_ASSERT(std::size(b) == size && std::size(result) == size);
+
+                if constexpr (detail::is_word_field_element<value_type>::value) {
+                    detail::word_batch_functions<value_type>::add(detail::word_data(std::data(result)),
+                                                                  detail::word_data(std::data(a)),
+                                                                  detail::word_data(std::data(b)), size);
+                } else {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        std::data(result)[i] = std::data(a)[i] + std::data(b)[i];
+                    }
+                }
+            }
+
+            /** @brief Element-wise product result[i] = a[i] * b[i] over contiguous ranges of field elements.
+             *  Same dispatch rules as batch_add.
+             */
+            template<typename Range>
+            void batch_mul(Range &result, const Range &a, const Range &b) {
+                typedef typename std::remove_cv<typename std::remove_reference<decltype(*std::data(a))>::type>::type
+                    value_type;
+
+                const std::size_t size = std::size(a);
+                BOOST_ASSERT(std::size(b) == size && std::size(result) == size);
+
+                if constexpr (detail::is_word_field_element<value_type>::value) {
+                    detail::word_batch_functions<value_type>::mul(detail::word_data(std::data(result)),
+                                                                  detail::word_data(std::data(a)),
+                                                                  detail::word_data(std::data(b)), size);
+                } else {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        std::data(result)[i] = std::data(a)[i] * std::data(b)[i];
+                    }
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_ARITHMETIC_HPP
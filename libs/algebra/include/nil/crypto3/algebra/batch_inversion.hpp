@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
+#define CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
+
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /** @brief Replaces every non-zero element of the range by its inverse using Montgomery's trick:
+             *  one field inversion and 3(n - 1) multiplications instead of n inversions.
+             *  Zero elements are left untouched.
+             *  @param values range of field elements
+             */
+            template<typename Range>
+            void batch_invert(Range &values) {
+                typedef typename std::iterator_traits<decltype(std::begin(values))>::value_type value_type;
+
+                const std::size_t size = std::distance(std::begin(values), std::end(values));
+                auto it = std::begin(values);
+
+                // prefix_products[i] is the product of all non-zero values before i
+                std::vector<value_type> prefix_products(size);
+                value_type accumulator = value_type::one();
+                for (std::size_t i = 0; i < size; ++i, ++it) {
+                    prefix_products[i] = accumulator;
+                    if (!it->is_zero()) {
+                        accumulator *= *it;
+                    }
+                }
+
+                // accumulator is the inverse of the product of all non-zero values processed so far
+                accumulator = accumulator.inversed();
+                for (std::size_t i = size; i > 0; --i) {
+                    --it;
+                    if (!it->is_zero()) {
+                        const value_type inverse = accumulator * prefix_products[i - 1];
+                        accumulator *= *it;
+                        *it = inverse;
+                    }
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
@@ -26,20 +26,81 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
-                    // TODO: temporary implementation due to absence of GroupValueType type_trait
-                    //  Should be implemented as class method
-                    template<typename GroupValueType, typename = typename std::enable_if<
-                                                          is_curve_group<typename GroupValueType::group_type>::value &&
-                                                          !is_field<typename GroupValueType::group_type>::value>::type>
-                    bool subgroup_check(const GroupValueType &p) {
-                        return (p * GroupValueType::group_type::curve_type::q).is_zero();
+                    /** @brief Number of random subset sums checked by batch_subgroup_check by default, a batch with
+                     *  a point outside of the subgroup passes with probability at most 2^-rounds.
+                     */
+                    constexpr std::size_t batch_subgroup_check_rounds = 128;
+
+                    /** @brief Checks that all the points of [first, last) lie in the prime order subgroup.
+                     *
+                     *  For every round k, the random subset sum S_k = sum b_ik * P_i with random bits b_ik is
+                     *  multiplied by the subgroup order. If some P_j has a nonzero component T_j outside of the
+                     *  subgroup, at most one value of b_jk cancels the cofactor component of S_k, so each round
+                     *  catches it with probability at least 1/2, whatever the factorization of the cofactor is.
+                     *  This costs about rounds / 2 additions per point and rounds scalar multiplications in total,
+                     *  against a full scalar multiplication per point for subgroup_check, so batches of less than
+                     *  about rounds points are checked one by one.
+                     *  The points must lie on the curve.
+                     *  If MULTICORE is defined, the rounds are distributed with OpenMP.
+                     */
+                    template<typename RandomAccessIterator>
+                    bool batch_subgroup_check(RandomAccessIterator first, RandomAccessIterator last,
+                                              std::size_t rounds = batch_subgroup_check_rounds) {
+                        typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+                        const std::size_t size = std::distance(first, last);
+                        std::vector<char> passed;
+
+                        if (size <= rounds) {
+                            passed.resize(size);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                            for (std::size_t i = 0; i < size; ++i) {
+                                passed[i] = subgroup_check(first[i]);
+                            }
+                            return std::all_of(passed.begin(), passed.end(), [](char p) { return p != 0; });
+                        }
+
+                        // bits of round k for point i are bit k % 64 of bits[i * words + k / 64]
+                        const std::size_t words = (rounds + 63) / 64;
+                        std::vector<std::uint64_t> bits(size * words);
+                        std::random_device device;
+                        std::seed_seq seed {device(), device(), device(), device(),
+                                            device(), device(), device(), device()};
+                        std::mt19937_64 rng(seed);
+                        for (auto &word : bits) {
+                            word = rng();
+                        }
+
+                        passed.resize(rounds);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t k = 0; k < rounds; ++k) {
+                            value_type sum = value_type::zero();
+                            for (std::size_t i = 0; i < size; ++i) {
+                                if ((bits[i * words + k / 64] >> (k % 64)) & 1) {
+                                    sum += first[i];
+                                }
+                            }
+                            passed[k] = subgroup_check(sum);
+                        }
+                        return std::all_of(passed.begin(), passed.end(), [](char p) { return p != 0; });
                     }
                 }    // namespace detail
             }        // namespace curves
@@ -0,0 +1,386 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/batch_affine.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                typedef boost::multiprecision::cpp_int signed_integral_type;
+
+                template<typename Number>
+                signed_integral_type to_signed_integral(const Number &value, std::size_t bits) {
+                    signed_integral_type result = 0;
+                    for (std::size_t i = 0; i < bits; ++i) {
+                        if (boost::multiprecision::bit_test(value, i)) {
+                            boost::multiprecision::bit_set(result, i);
+                        }
+                    }
+                    return result;
+                }
+
+                // round(numerator / denominator) for a positive denominator
+                inline signed_integral_type rounded_division(const signed_integral_type &numerator,
+                                                             const signed_integral_type &denominator) {
+                    if (numerator >= 0) {
+                        return (2 * numerator + denominator) / (2 * denominator);
+                    }
+                    return -((-2 * numerator + denominator) / (2 * denominator));
+                }
+
+                /** @brief Width-w non-adjacent form of a non-negative integer: odd digits in
+                 *  (-2^(w - 1), 2^(w - 1)), least significant first, any w consecutive of them having at most
+                 *  one nonzero.
+                 */
+                inline std::vector<std::int32_t> signed_integral_wnaf(signed_integral_type value, std::size_t width) {
+                    const std::int32_t modulus = std::int32_t(1) << width;
+                    std::vector<std::int32_t> digits;
+                    while (!value.is_zero()) {
+                        std::int32_t digit = 0;
+                        if (boost::multiprecision::bit_test(value, 0)) {
+                            for (std::size_t j = 0; j < width; ++j) {
+                                if (boost::multiprecision::bit_test(value, j)) {
+                                    digit += std::int32_t(1) << j;
+                                }
+                            }
+                            if (digit >= modulus / 2) {
+                                digit -= modulus;
+                            }
+                            value -= digit;
+                        }
+                        digits.push_back(digit);
+                        value >>= 1;
+                    }
+                    return digits;
+                }
+
+                // curves with j-invariant 0 over a prime field, y^2 = x^3 + b, can carry the endomorphism
+                // (x, y) -> (beta * x, y)
+                template<typename CurveElementType>
+                struct is_glv_candidate
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<typename CurveElementType::form, curves::forms::short_weierstrass>::value &&
+                              CurveElementType::field_type::arity == 1> { };
+
+                /** @brief GLV endomorphism phi(x, y) = (beta * x, y) of the group, acting on the prime-order
+                 *  subgroup as multiplication by lambda, where beta and lambda are primitive cube roots of unity
+                 *  of the base and the scalar fields.
+                 *
+                 *  beta, lambda and a reduced basis of the lattice {(a, b) : a + b * lambda = 0 mod r} are derived
+                 *  once per group from the curve parameters, so every curve y^2 = x^3 + b over a prime field with
+                 *  p = r = 1 mod 3 is covered (secp256k1, BLS12-381 G1, alt_bn128 G1, Pallas, Vesta) without
+                 *  per-curve constants. Groups lacking such an endomorphism report is_applicable() == false.
+                 */
+                template<typename GroupType, bool IsCandidate = is_glv_candidate<typename GroupType::value_type>::value>
+                class glv_endomorphism {
+                public:
+                    typedef typename GroupType::value_type value_type;
+
+                    bool is_applicable() const {
+                        return false;
+                    }
+
+                    value_type apply(const value_type &point) const {
+                        return point;
+                    }
+
+                    std::pair<signed_integral_type, signed_integral_type>
+                        decompose(const signed_integral_type &scalar) const {
+                        return std::make_pair(scalar, signed_integral_type(0));
+                    }
+                };
+
+                template<typename GroupType>
+                class glv_endomorphism<GroupType, true> {
+                public:
+                    typedef typename GroupType::value_type value_type;
+                    typedef typename value_type::field_type field_type;
+                    typedef typename field_type::value_type field_value_type;
+                    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_value_type;
+
+                    glv_endomorphism() : applicable(false) {
+                        const signed_integral_type p = to_signed_integral(field_type::modulus, field_type::modulus_bits);
+                        const signed_integral_type r =
+                            to_signed_integral(scalar_field_type::modulus, scalar_field_type::modulus_bits);
+                        if (!value_type::params_type::a.is_zero() || p % 3 != 1 || r % 3 != 1) {
+                            return;
+                        }
+
+                        beta = primitive_cube_root<field_type>();
+                        scalar_value_type lambda = primitive_cube_root<scalar_field_type>();
+
+                        // phi acts either as lambda or as lambda^2 = -1 - lambda
+                        const value_type one = value_type::one();
+                        if (apply(one) != lambda * one) {
+                            lambda = lambda.squared();
+                            if (apply(one) != lambda * one) {
+                                return;
+                            }
+                        }
+
+                        reduce_lattice(r, to_signed_integral(typename scalar_field_type::integral_type(lambda.data),
+                                                             scalar_field_type::modulus_bits));
+                        modulus = r;
+                        applicable = true;
+                    }
+
+                    bool is_applicable() const {
+                        return applicable;
+                    }
+
+                    value_type apply(const value_type &point) const {
+                        value_type result = point;
+                        result.X *= beta;
+                        return result;
+                    }
+
+                    /// Splits 0 <= scalar < r into (k1, k2) with k1 + k2 * lambda = scalar mod r and |k1|, |k2| ~ sqrt(r)
+                    std::pair<signed_integral_type, signed_integral_type>
+                        decompose(const signed_integral_type &scalar) const {
+                        const signed_integral_type c1 = rounded_division(b2 * scalar, modulus);
+                        const signed_integral_type c2 = rounded_division(-b1 * scalar, modulus);
+                        return std::make_pair(signed_integral_type(scalar - c1 * a1 - c2 * a2),
+                                              signed_integral_type(-c1 * b1 - c2 * b2));
+                    }
+
+                private:
+                    template<typename FieldType>
+                    static typename FieldType::value_type primitive_cube_root() {
+                        const typename FieldType::integral_type exponent = (FieldType::modulus - 1) / 3;
+                        for (std::size_t g = 2;; ++g) {
+                            const typename FieldType::value_type root = typename FieldType::value_type(g).pow(exponent);
+                            if (!root.is_one()) {
+                                return root;
+                            }
+                        }
+                    }
+
+                    // extended Euclidean algorithm on (r, lambda), Guide to Elliptic Curve Cryptography, algorithm 3.74
+                    void reduce_lattice(const signed_integral_type &r, const signed_integral_type &lambda) {
+                        signed_integral_type r_prev = r, r_cur = lambda;
+                        signed_integral_type t_prev = 0, t_cur = 1;
+                        // r_cur is the first remainder below sqrt(r)
+                        while (r_cur * r_cur >= r) {
+                            const signed_integral_type q = r_prev / r_cur;
+                            signed_integral_type r_next = r_prev - q * r_cur;
+                            signed_integral_type t_next = t_prev - q * t_cur;
+                            r_prev = std::move(r_cur);
+                            r_cur = std::move(r_next);
+                            t_prev = std::move(t_cur);
+                            t_cur = std::move(t_next);
+                        }
+                        const signed_integral_type q = r_prev / r_cur;
+                        const signed_integral_type r_next = r_prev - q * r_cur;
+                        const signed_integral_type t_next = t_prev - q * t_cur;
+
+                        a1 = r_cur;
+                        b1 = -t_cur;
+                        if (r_prev * r_prev + t_prev * t_prev <= r_next * r_next + t_next * t_next) {
+                            a2 = r_prev;
+                            b2 = -t_prev;
+                        } else {
+                            a2 = r_next;
+                            b2 = -t_next;
+                        }
+                    }
+
+                    bool applicable;
+                    field_value_type beta;
+                    signed_integral_type modulus;
+                    signed_integral_type a1, b1, a2, b2;
+                };
+
+                /** @brief Interleaved (Straus-Shamir) multi-scalar multiplication of a few points: every base gets
+                 *  a table of its odd multiples and a wNAF of its scalar, and all the digits share one chain of
+                 *  doublings.
+                 */
+                template<typename GroupType, std::size_t WindowBits = 5>
+                class interleaved_wnaf {
+                public:
+                    typedef typename GroupType::value_type value_type;
+
+                    constexpr static const std::size_t window_bits = WindowBits;
+                    constexpr static const std::size_t table_size = std::size_t(1) << (window_bits - 2);
+
+                    /// Adds scalar * base to the sum, negative scalars are accepted
+                    void add_term(const signed_integral_type &scalar, const value_type &base) {
+                        if (scalar.is_zero() || base.is_zero()) {
+                            return;
+                        }
+                        push_digits(scalar, push_table(base));
+                    }
+
+                    /** @brief Adds k1 * base + k2 * phi(base) to the sum. The multiples of phi(base) are mapped
+                     *  from the multiples of base, as phi(j * base) = j * phi(base).
+                     */
+                    template<typename Endomorphism>
+                    void add_term(const signed_integral_type &k1, const signed_integral_type &k2,
+                                  const value_type &base, const Endomorphism &endomorphism) {
+                        if (base.is_zero() || (k1.is_zero() && k2.is_zero())) {
+                            return;
+                        }
+                        const std::size_t offset = push_table(base);
+                        if (!k1.is_zero()) {
+                            push_digits(k1, offset);
+                        }
+                        if (!k2.is_zero()) {
+                            const std::size_t mapped_offset = table.size();
+                            for (std::size_t j = 0; j < table_size; ++j) {
+                                table.push_back(endomorphism.apply(table[offset + j]));
+                            }
+                            push_digits(k2, mapped_offset);
+                        }
+                    }
+
+                    value_type sum() {
+                        normalize(std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+
+                        std::size_t length = 0;
+                        for (const std::vector<std::int32_t> &d : digits) {
+                            length = std::max(length, d.size());
+                        }
+
+                        value_type result = value_type::zero();
+                        for (std::size_t i = length; i-- > 0;) {
+                            result.double_inplace();
+                            for (std::size_t t = 0; t < digits.size(); ++t) {
+                                if (i >= digits[t].size() || digits[t][i] == 0) {
+                                    continue;
+                                }
+                                const std::int32_t digit = digits[t][i];
+                                if (digit > 0) {
+                                    add(result, table[offsets[t] + digit / 2],
+                                        std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+                                } else {
+                                    add(result, -table[offsets[t] - digit / 2],
+                                        std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+                                }
+                            }
+                        }
+                        return result;
+                    }
+
+                private:
+                    std::size_t push_table(const value_type &base) {
+                        const std::size_t offset = table.size();
+                        value_type doubled = base;
+                        doubled.double_inplace();
+                        table.push_back(base);
+                        for (std::size_t j = 1; j < table_size; ++j) {
+                            table.push_back(table.back() + doubled);
+                        }
+                        return offset;
+                    }
+
+                    // the sign of the scalar goes into its digits, so tables always hold positive multiples
+                    void push_digits(const signed_integral_type &scalar, std::size_t offset) {
+                        offsets.push_back(offset);
+                        digits.push_back(signed_integral_wnaf(scalar < 0 ? signed_integral_type(-scalar) : scalar,
+                                                              window_bits));
+                        if (scalar < 0) {
+                            for (std::int32_t &digit : digits.back()) {
+                                digit = -digit;
+                            }
+                        }
+                    }
+
+                    void normalize(std::true_type) {
+                        batch_normalize(table);
+                    }
+
+                    void normalize(std::false_type) {
+                    }
+
+                    // tables of equal or related bases share entries, which may meet the sum
+                    static void add(value_type &result, const value_type &point, std::true_type) {
+                        checked_mixed_add(result, point);
+                    }
+
+                    static void add(value_type &result, const value_type &point, std::false_type) {
+                        result += point;
+                    }
+
+                    std::vector<value_type> table;
+                    std::vector<std::size_t> offsets;
+                    std::vector<std::vector<std::int32_t>> digits;
+                };
+            }    // namespace detail
+
+            /** @brief Computes a * P + b * Q with a single chain of doublings (Straus-Shamir trick with wNAF).
+             *
+             *  On groups with a GLV endomorphism (secp256k1, BLS12-381 G1, alt_bn128 G1, Pallas, Vesta) both
+             *  scalars are further split into halves of about modulus_bits / 2 bits, halving the doublings.
+             *  P and Q must lie in the prime-order subgroup. The running time depends on the scalars.
+             */
+            template<typename GroupType>
+            typename GroupType::value_type
+                double_scalar_mul(const typename GroupType::curve_type::scalar_field_type::value_type &a,
+                                  const typename GroupType::value_type &P,
+                                  const typename GroupType::curve_type::scalar_field_type::value_type &b,
+                                  const typename GroupType::value_type &Q) {
+                typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::integral_type integral_type;
+
+                static const detail::glv_endomorphism<GroupType> endomorphism;
+
+                const detail::signed_integral_type k_a =
+                    detail::to_signed_integral(integral_type(a.data), scalar_field_type::modulus_bits);
+                const detail::signed_integral_type k_b =
+                    detail::to_signed_integral(integral_type(b.data), scalar_field_type::modulus_bits);
+
+                detail::interleaved_wnaf<GroupType> straus;
+                if (endomorphism.is_applicable()) {
+                    const auto split_a = endomorphism.decompose(k_a);
+                    const auto split_b = endomorphism.decompose(k_b);
+                    straus.add_term(split_a.first, split_a.second, P, endomorphism);
+                    straus.add_term(split_b.first, split_b.second, Q, endomorphism);
+                } else {
+                    straus.add_term(k_a, P);
+                    straus.add_term(k_b, Q);
+                }
+                return straus.sum();
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
@@ -26,6 +26,8 @@
 #define CRYPTO3_ALGEBRA_FIELDS_BABYBEAR_BASE_FIELD_HPP
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp_word.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/babybear.hpp>
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/field.hpp>
@@ -75,6 +77,17 @@ namespace nil {
                 constexpr typename babybear_base_field::integral_type const babybear_base_field::group_order_minus_one_half;
                 constexpr
                 typename babybear_base_field::modular_params_type const babybear_base_field::modulus_params;
+
+                namespace detail {
+                    template<>
+                    class element_fp<params<babybear_base_field>>
+                        : public element_fp_word<params<babybear_base_field>, babybear_word_arithmetic> {
+                        typedef element_fp_word<params<babybear_base_field>, babybear_word_arithmetic> base_type;
+
+                    public:
+                        using base_type::base_type;
+                    };
+                }    // namespace detail
 #endif
                 using babybear_fq = babybear_base_field;
 
@@ -296,7 +296,7 @@ namespace nil {
 
 template<typename FieldParams>
 struct std::hash<typename nil::crypto3::algebra::fields::detail::element_fp<FieldParams>> {
-    std::hash<typename nil::crypto3::algebra::fields::detail::element_fp<FieldParams>::modular_type> hasher;
+    std::hash<typename nil::crypto3::algebra::fields::detail::element_fp<FieldParams>::data_type> hasher;
 
     size_t operator()(const nil::crypto3::algebra::fields::detail::element_fp<FieldParams> &elem) const {
         std::size_t result = hasher(elem.data);
@@ -0,0 +1,451 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_WORD_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_WORD_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * @brief data_type of element_fp_word: a canonical (fully reduced, non-Montgomery) word which
+                     * converts to and from modular_type and integral_type, so code written against the data of
+                     * the generic element_fp keeps working.
+                     */
+                    template<typename FieldParams, typename WordArithmetic>
+                    struct element_fp_word_data {
+                        typedef typename FieldParams::modular_type modular_type;
+                        typedef typename FieldParams::integral_type integral_type;
+                        typedef typename WordArithmetic::word_type word_type;
+
+                        word_type value = 0;
+
+                        constexpr element_fp_word_data() = default;
+
+                        constexpr explicit element_fp_word_data(word_type value) : value(value) {
+                        }
+
+                        constexpr element_fp_word_data(const modular_type &data) :
+                            value(static_cast<word_type>(
+                                data.template convert_to<integral_type>().template convert_to<std::uint64_t>())) {
+                        }
+
+                        constexpr operator modular_type() const {
+                            return modular_type(typename modular_type::backend_type(static_cast<std::uint64_t>(value),
+                                                                                    FieldParams::modulus_params));
+                        }
+
+                        constexpr explicit operator integral_type() const {
+                            return integral_type(static_cast<std::uint64_t>(value));
+                        }
+
+                        template<typename T>
+                        constexpr T convert_to() const {
+                            return integral_type(*this).template convert_to<T>();
+                        }
+
+                        constexpr bool is_zero() const {
+                            return value == 0;
+                        }
+
+                        constexpr bool operator==(const element_fp_word_data &other) const {
+                            return value == other.value;
+                        }
+
+                        constexpr bool operator!=(const element_fp_word_data &other) const {
+                            return value != other.value;
+                        }
+
+                        constexpr bool operator<(const element_fp_word_data &other) const {
+                            return value < other.value;
+                        }
+
+                        constexpr bool operator>(const element_fp_word_data &other) const {
+                            return value > other.value;
+                        }
+
+                        constexpr bool operator<=(const element_fp_word_data &other) const {
+                            return value <= other.value;
+                        }
+
+                        constexpr bool operator>=(const element_fp_word_data &other) const {
+                            return value >= other.value;
+                        }
+
+                        template<typename Number,
+                                 typename std::enable_if<std::is_integral<Number>::value, bool>::type = true>
+                        constexpr bool operator==(const Number &other) const {
+                            if constexpr (std::is_signed<Number>::value) {
+                                if (other < 0) {
+                                    return false;
+                                }
+                            }
+                            return static_cast<std::uint64_t>(other) == value;
+                        }
+
+                        template<typename Number,
+                                 typename std::enable_if<std::is_integral<Number>::value, bool>::type = true>
+                        constexpr bool operator!=(const Number &other) const {
+                            return !(*this == other);
+                        }
+                    };
+
+                    template<typename FieldParams, typename WordArithmetic>
+                    std::ostream &operator<<(std::ostream &os,
+                                             const element_fp_word_data<FieldParams, WordArithmetic> &data) {
+                        os << static_cast<std::uint64_t>(data.value);
+                        return os;
+                    }
+
+                    /**
+                     * @brief element_fp implementation for fields whose modulus fits into a machine word.
+                     * The value is kept as element_fp_word_data, a canonical word, and the arithmetic is delegated
+                     * to WordArithmetic, see fields/detail/word_arithmetic. Fields opt in by specializing
+                     * element_fp<params<Field>> as a class derived from this one.
+                     */
+                    template<typename FieldParams, typename WordArithmetic>
+                    class element_fp_word {
+                        typedef FieldParams policy_type;
+                        typedef element_fp<FieldParams> element_type;
+
+                    public:
+                        typedef typename policy_type::field_type field_type;
+
+                        typedef typename policy_type::modular_type modular_type;
+                        typedef typename policy_type::integral_type integral_type;
+                        typedef typename policy_type::modular_backend modular_backend;
+                        typedef typename policy_type::modular_params_type modular_params_type;
+
+                        typedef WordArithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+
+                        constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
+                        constexpr static const integral_type modulus = policy_type::modulus;
+
+                        using data_type = element_fp_word_data<FieldParams, WordArithmetic>;
+                        data_type data;
+
+                        constexpr element_fp_word() = default;
+
+                        constexpr element_fp_word(const data_type &data) : data(data) {
+                        }
+
+                        constexpr element_fp_word(const modular_type &value) : data(value) {
+                        }
+
+                        template<typename Number,
+                                 typename std::enable_if<(boost::multiprecision::is_number<Number>::value), bool>::type = true>
+                        constexpr element_fp_word(const Number &value) :
+                            data(static_cast<word_type>(
+                                (value % Number(arithmetic_type::modulus)).template convert_to<std::uint64_t>())) {
+                        }
+
+                        template<typename Number,
+                                 typename std::enable_if<std::is_integral<Number>::value && std::is_unsigned<Number>::value,
+                                                         bool>::type = true>
+                        constexpr element_fp_word(const Number &value) :
+                            data(arithmetic_type::reduce(static_cast<std::uint64_t>(value))) {
+                        }
+
+                        template<typename Number,
+                                 typename std::enable_if<std::is_integral<Number>::value && std::is_signed<Number>::value,
+                                                         bool>::type = true>
+                        constexpr element_fp_word(const Number &value) :
+                            data(value < 0 ? arithmetic_type::neg(arithmetic_type::reduce(
+                                                 std::uint64_t(0) - static_cast<std::uint64_t>(value))) :
+                                             arithmetic_type::reduce(static_cast<std::uint64_t>(value))) {
+                        }
+
+                        constexpr static element_type from_data(word_type value) {
+                            element_type result;
+                            result.data.value = value;
+                            return result;
+                        }
+
+                        constexpr static const element_type &zero();
+
+                        constexpr static const element_type &one();
+
+                        constexpr bool is_zero() const {
+                            return data.value == 0;
+                        }
+
+                        constexpr bool is_one() const {
+                            return data.value == 1;
+                        }
+
+                        constexpr bool operator==(const element_type &B) const {
+                            return data.value == B.data.value;
+                        }
+
+                        constexpr bool operator!=(const element_type &B) const {
+                            return data.value != B.data.value;
+                        }
+
+                        constexpr element_type operator+(const element_type &B) const {
+                            return from_data(arithmetic_type::add(data.value, B.data.value));
+                        }
+
+                        constexpr element_type operator-(const element_type &B) const {
+                            return from_data(arithmetic_type::sub(data.value, B.data.value));
+                        }
+
+                        constexpr element_type &operator-=(const element_type &B) {
+                            data.value = arithmetic_type::sub(data.value, B.data.value);
+                            return self();
+                        }
+
+                        constexpr element_type &operator+=(const element_type &B) {
+                            data.value = arithmetic_type::add(data.value, B.data.value);
+                            return self();
+                        }
+
+                        constexpr element_type &operator*=(const element_type &B) {
+                            data.value = arithmetic_type::mul(data.value, B.data.value);
+                            return self();
+                        }
+
+                        constexpr element_type &operator/=(const element_type &B) {
+                            data.value = arithmetic_type::mul(data.value, B.inversed().data.value);
+                            return self();
+                        }
+
+                        constexpr element_type operator-() const {
+                            return from_data(arithmetic_type::neg(data.value));
+                        }
+
+                        constexpr void negate_inplace() {
+                            data.value = arithmetic_type::neg(data.value);
+                        }
+
+                        constexpr element_type operator/(const element_type &B) const {
+                            return from_data(arithmetic_type::mul(data.value, B.inversed().data.value));
+                        }
+
+                        constexpr element_type operator*(const element_type &B) const {
+                            return from_data(arithmetic_type::mul(data.value, B.data.value));
+                        }
+
+                        constexpr bool operator<(const element_type &B) const {
+                            return data.value < B.data.value;
+                        }
+
+                        constexpr bool operator>(const element_type &B) const {
+                            return data.value > B.data.value;
+                        }
+
+                        constexpr bool operator<=(const element_type &B) const {
+                            return data.value <= B.data.value;
+                        }
+
+                        constexpr bool operator>=(const element_type &B) const {
+                            return data.value >= B.data.value;
+                        }
+
+                        constexpr element_type &operator++() {
+                            data.value = arithmetic_type::add(data.value, 1);
+                            return self();
+                        }
+
+                        constexpr element_type operator++(int) {
+                            element_type temp = self();
+                            ++*this;
+                            return temp;
+                        }
+
+                        constexpr element_type &operator--() {
+                            data.value = arithmetic_type::sub(data.value, 1);
+                            return self();
+                        }
+
+                        constexpr element_type operator--(int) {
+                            element_type temp = self();
+                            --*this;
+                            return temp;
+                        }
+
+                        constexpr element_type doubled() const {
+                            return from_data(arithmetic_type::add(data.value, data.value));
+                        }
+
+                        constexpr void double_inplace() {
+                            data.value = arithmetic_type::add(data.value, data.value);
+                        }
+
+                        constexpr element_type squared() const {
+                            return from_data(arithmetic_type::mul(data.value, data.value));
+                        }
+
+                        constexpr element_type &square_inplace() {
+                            data.value = arithmetic_type::mul(data.value, data.value);
+                            return self();
+                        }
+
+                        constexpr element_type inversed() const {
+                            return from_data(pow_word(data.value, arithmetic_type::modulus - 2));
+                        }
+
+                        // TODO: complete method
+                        constexpr element_type _2z_add_3x() {
+                        }
+
+                        constexpr bool is_square() const {
+                            const word_type legendre = pow_word(data.value, (arithmetic_type::modulus - 1) / 2);
+                            return legendre == 0 || legendre == 1;
+                        }
+
+                        // If the element does not have a square root, this function must not be called.
+                        // Call is_square() before using this function.
+                        constexpr element_type sqrt() const {
+                            // Tonelli-Shanks with p - 1 = 2^two_adicity * two_adic_odd_factor
+                            if (is_zero()) {
+                                return zero();
+                            }
+                            std::size_t m = arithmetic_type::two_adicity;
+                            word_type c = pow_word(arithmetic_type::quadratic_nonresidue, arithmetic_type::two_adic_odd_factor);
+                            word_type t = pow_word(data.value, arithmetic_type::two_adic_odd_factor);
+                            word_type r = pow_word(data.value, (arithmetic_type::two_adic_odd_factor + 1) / 2);
+                            while (t != 1) {
+                                std::size_t i = 0;
+                                word_type t_pow = t;
+                                while (t_pow != 1 && i < m) {
+                                    t_pow = arithmetic_type::mul(t_pow, t_pow);
+                                    ++i;
+                                }
+                                if (i == m) {
+                                    // not a square
+                                    return zero();
+                                }
+                                word_type b = c;
+                                for (std::size_t j = 0; j + i + 1 < m; ++j) {
+                                    b = arithmetic_type::mul(b, b);
+                                }
+                                m = i;
+                                c = arithmetic_type::mul(b, b);
+                                t = arithmetic_type::mul(t, c);
+                                r = arithmetic_type::mul(r, b);
+                            }
+                            return from_data(r);
+                        }
+
+                        template<typename PowerType,
+                                 typename = typename std::enable_if<std::is_integral<PowerType>::value>::type>
+                        constexpr element_type pow(const PowerType pwr) const {
+                            return from_data(pow_word(data.value, static_cast<std::uint64_t>(pwr)));
+                        }
+
+                        template<typename Backend, boost::multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr element_type
+                            pow(const boost::multiprecision::number<Backend, ExpressionTemplates> &pwr) const {
+                            typedef boost::multiprecision::number<Backend, ExpressionTemplates> power_type;
+                            if (pwr == 0u) {
+                                return one();
+                            }
+                            if (is_zero()) {
+                                return zero();
+                            }
+                            if (boost::multiprecision::msb(pwr) < 64) {
+                                return from_data(pow_word(data.value, pwr.template convert_to<std::uint64_t>()));
+                            }
+                            // a^(p - 1) = 1 for a != 0, so a wider exponent can be reduced to a single word
+                            const power_type group_order = power_type(arithmetic_type::modulus - 1);
+                            return from_data(
+                                pow_word(data.value, (pwr % group_order).template convert_to<std::uint64_t>()));
+                        }
+
+                    private:
+                        constexpr element_type &self() {
+                            return static_cast<element_type &>(*this);
+                        }
+
+                        constexpr const element_type &self() const {
+                            return static_cast<const element_type &>(*this);
+                        }
+
+                        constexpr static word_type pow_word(word_type base, std::uint64_t exponent) {
+                            word_type result = 1;
+                            while (exponent != 0) {
+                                if (exponent & 1u) {
+                                    result = arithmetic_type::mul(result, base);
+                                }
+                                base = arithmetic_type::mul(base, base);
+                                exponent >>= 1;
+                            }
+                            return result;
+                        }
+                    };
+
+                    template<typename FieldParams, typename WordArithmetic>
+                    constexpr typename element_fp_word<FieldParams, WordArithmetic>::integral_type const
+                        element_fp_word<FieldParams, WordArithmetic>::modulus;
+
+                    template<typename FieldParams, typename WordArithmetic>
+                    constexpr typename element_fp_word<FieldParams, WordArithmetic>::modular_params_type const
+                        element_fp_word<FieldParams, WordArithmetic>::modulus_params;
+
+                    namespace element_fp_word_details {
+                        template<typename FieldParams>
+                        constexpr static element_fp<FieldParams> zero_instance = 0u;
+
+                        template<typename FieldParams>
+                        constexpr static element_fp<FieldParams> one_instance = 1u;
+                    }    // namespace element_fp_word_details
+
+                    template<typename FieldParams, typename WordArithmetic>
+                    constexpr const element_fp<FieldParams> &element_fp_word<FieldParams, WordArithmetic>::zero() {
+                        return element_fp_word_details::zero_instance<FieldParams>;
+                    }
+
+                    template<typename FieldParams, typename WordArithmetic>
+                    constexpr const element_fp<FieldParams> &element_fp_word<FieldParams, WordArithmetic>::one() {
+                        return element_fp_word_details::one_instance<FieldParams>;
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+template<typename FieldParams, typename WordArithmetic>
+struct std::hash<typename nil::crypto3::algebra::fields::detail::element_fp_word_data<FieldParams, WordArithmetic>> {
+    std::hash<typename WordArithmetic::word_type> hasher;
+
+    size_t operator()(
+        const nil::crypto3::algebra::fields::detail::element_fp_word_data<FieldParams, WordArithmetic> &data) const {
+        return hasher(data.value);
+    }
+};
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_WORD_HPP
@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BABYBEAR_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BABYBEAR_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * @brief Native arithmetic modulo p = 15 * 2^27 + 1 on canonical 32-bit words.
+                     * Products are reduced with 32-bit Montgomery reduction, the second reduction by
+                     * R^2 mod p brings the result back from Montgomery form.
+                     */
+                    struct babybear_word_arithmetic {
+                        typedef std::uint32_t word_type;
+
+                        constexpr static const word_type modulus = 0x78000001u;
+                        // p^{-1} mod 2^32
+                        constexpr static const word_type montgomery_inverse = 0x88000001u;
+                        // 2^64 mod p
+                        constexpr static const word_type montgomery_r2 = 0x45dddde3u;
+
+                        constexpr static const std::size_t two_adicity = 27;
+                        constexpr static const word_type two_adic_odd_factor = 15;
+                        constexpr static const word_type quadratic_nonresidue = 31;
+
+                        constexpr static inline word_type reduce(std::uint64_t value) {
+                            return static_cast<word_type>(value % modulus);
+                        }
+
+                        constexpr static inline word_type add(word_type a, word_type b) {
+                            // 2p < 2^32, so the sum never wraps
+                            const word_type sum = a + b;
+                            return sum >= modulus ? sum - modulus : sum;
+                        }
+
+                        constexpr static inline word_type sub(word_type a, word_type b) {
+                            return a >= b ? a - b : a + (modulus - b);
+                        }
+
+                        constexpr static inline word_type neg(word_type a) {
+                            return a == 0 ? 0 : modulus - a;
+                        }
+
+                        // Returns value * 2^{-32} mod p for value < p * 2^32.
+                        constexpr static inline word_type montgomery_reduce(std::uint64_t value) {
+                            const word_type q = static_cast<word_type>(value) * montgomery_inverse;
+                            const std::uint64_t qp = static_cast<std::uint64_t>(q) * modulus;
+                            // low halves of value and q * p coincide, so the difference is exact
+                            const word_type value_hi = static_cast<word_type>(value >> 32);
+                            const word_type qp_hi = static_cast<word_type>(qp >> 32);
+                            word_type result = value_hi - qp_hi;
+                            if (value_hi < qp_hi) {
+                                result += modulus;
+                            }
+                            return result;
+                        }
+
+                        constexpr static inline word_type mul(word_type a, word_type b) {
+                            return montgomery_reduce(
+                                static_cast<std::uint64_t>(montgomery_reduce(static_cast<std::uint64_t>(a) * b)) *
+                                montgomery_r2);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BABYBEAR_HPP
@@ -0,0 +1,241 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX2_IMPL_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX2_IMPL_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/goldilocks64.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/babybear.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/m31.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_impl.hpp>
+
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    template<typename WordArithmetic>
+                    struct word_batch_avx2_impl : public word_batch_impl<WordArithmetic> { };
+
+                    template<>
+                    struct word_batch_avx2_impl<goldilocks64_word_arithmetic> {
+                        typedef goldilocks64_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 4;
+
+                        // AVX2 only has signed 64-bit comparison, flipping the sign bit makes it unsigned
+                        static inline __m256i less_than(__m256i a, __m256i b) {
+                            const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+                            return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign), _mm256_xor_si256(a, sign));
+                        }
+
+                        static inline __m256i canonicalize(__m256i value) {
+                            const __m256i p = _mm256_set1_epi64x(arithmetic_type::modulus);
+                            return _mm256_sub_epi64(value, _mm256_andnot_si256(less_than(value, p), p));
+                        }
+
+                        static inline __m256i add(__m256i a, __m256i b) {
+                            const __m256i epsilon = _mm256_set1_epi64x(arithmetic_type::epsilon);
+                            __m256i sum = _mm256_add_epi64(a, b);
+                            sum = _mm256_add_epi64(sum, _mm256_and_si256(less_than(sum, a), epsilon));
+                            return canonicalize(sum);
+                        }
+
+                        static inline __m256i mul(__m256i a, __m256i b) {
+                            const __m256i epsilon = _mm256_set1_epi64x(arithmetic_type::epsilon);
+                            const __m256i a_hi = _mm256_srli_epi64(a, 32);
+                            const __m256i b_hi = _mm256_srli_epi64(b, 32);
+
+                            // 64x64 -> 128 schoolbook multiplication out of four 32x32 products
+                            const __m256i ll = _mm256_mul_epu32(a, b);
+                            const __m256i lh = _mm256_mul_epu32(a, b_hi);
+                            const __m256i hl = _mm256_mul_epu32(a_hi, b);
+                            const __m256i hh = _mm256_mul_epu32(a_hi, b_hi);
+
+                            const __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+                            const __m256i u = _mm256_add_epi64(lh, _mm256_and_si256(t, epsilon));
+                            const __m256i lo = _mm256_or_si256(_mm256_slli_epi64(u, 32), _mm256_and_si256(ll, epsilon));
+                            const __m256i hi =
+                                _mm256_add_epi64(hh, _mm256_add_epi64(_mm256_srli_epi64(t, 32), _mm256_srli_epi64(u, 32)));
+
+                            // Same folding as goldilocks64_word_arithmetic::reduce128
+                            const __m256i hi_hi = _mm256_srli_epi64(hi, 32);
+                            const __m256i hi_lo = _mm256_and_si256(hi, epsilon);
+                            __m256i t0 = _mm256_sub_epi64(lo, hi_hi);
+                            t0 = _mm256_sub_epi64(t0, _mm256_and_si256(less_than(lo, hi_hi), epsilon));
+                            const __m256i t1 = _mm256_mul_epu32(hi_lo, epsilon);
+                            __m256i t2 = _mm256_add_epi64(t0, t1);
+                            t2 = _mm256_add_epi64(t2, _mm256_and_si256(less_than(t2, t1), epsilon));
+                            return canonicalize(t2);
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+
+                    template<>
+                    struct word_batch_avx2_impl<babybear_word_arithmetic> {
+                        typedef babybear_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 8;
+
+                        static inline __m256i add(__m256i a, __m256i b) {
+                            const __m256i p = _mm256_set1_epi32(arithmetic_type::modulus);
+                            const __m256i sum = _mm256_add_epi32(a, b);
+                            // sum < 2p: when sum < p, sum - p wraps and the minimum picks sum
+                            return _mm256_min_epu32(sum, _mm256_sub_epi32(sum, p));
+                        }
+
+                        // Montgomery reduction of a * b in even and odd 32-bit lanes separately
+                        static inline __m256i montgomery_mul(__m256i a, __m256i b) {
+                            const __m256i p = _mm256_set1_epi32(arithmetic_type::modulus);
+                            const __m256i mu = _mm256_set1_epi32(arithmetic_type::montgomery_inverse);
+
+                            const __m256i x_evn = _mm256_mul_epu32(a, b);
+                            const __m256i x_odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+                            const __m256i qp_evn = _mm256_mul_epu32(_mm256_mul_epu32(x_evn, mu), p);
+                            const __m256i qp_odd = _mm256_mul_epu32(_mm256_mul_epu32(x_odd, mu), p);
+
+                            // Low halves cancel, high halves hold x_hi - qp_hi in (-p, p)
+                            const __m256i d_evn = _mm256_srli_epi64(_mm256_sub_epi64(x_evn, qp_evn), 32);
+                            const __m256i d_odd = _mm256_sub_epi64(x_odd, qp_odd);
+                            const __m256i d = _mm256_blend_epi32(d_evn, d_odd, 0xAA);
+                            return _mm256_min_epu32(d, _mm256_add_epi32(d, p));
+                        }
+
+                        static inline __m256i mul(__m256i a, __m256i b) {
+                            const __m256i r2 = _mm256_set1_epi32(arithmetic_type::montgomery_r2);
+                            return montgomery_mul(montgomery_mul(a, b), r2);
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+
+                    template<>
+                    struct word_batch_avx2_impl<m31_word_arithmetic> {
+                        typedef m31_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 8;
+
+                        static inline __m256i add(__m256i a, __m256i b) {
+                            const __m256i p = _mm256_set1_epi32(arithmetic_type::modulus);
+                            const __m256i sum = _mm256_add_epi32(a, b);
+                            return _mm256_min_epu32(sum, _mm256_sub_epi32(sum, p));
+                        }
+
+                        static inline __m256i mul(__m256i a, __m256i b) {
+                            const __m256i p = _mm256_set1_epi32(arithmetic_type::modulus);
+                            const __m256i p64 = _mm256_set1_epi64x(arithmetic_type::modulus);
+
+                            const __m256i x_evn = _mm256_mul_epu32(a, b);
+                            const __m256i x_odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+
+                            // x < 2^62 folds into less than 2^32, which fits back into 32-bit lanes
+                            const __m256i t_evn = _mm256_add_epi64(_mm256_and_si256(x_evn, p64), _mm256_srli_epi64(x_evn, 31));
+                            const __m256i t_odd = _mm256_add_epi64(_mm256_and_si256(x_odd, p64), _mm256_srli_epi64(x_odd, 31));
+                            __m256i t = _mm256_blend_epi32(t_evn, _mm256_slli_epi64(t_odd, 32), 0xAA);
+
+                            // Second fold gives a value in [0, p]
+                            t = _mm256_add_epi32(_mm256_and_si256(t, p), _mm256_srli_epi32(t, 31));
+                            return _mm256_min_epu32(t, _mm256_sub_epi32(t, p));
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                                const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                                _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX2_IMPL_HPP
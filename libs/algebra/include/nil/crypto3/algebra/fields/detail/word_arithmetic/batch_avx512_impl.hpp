@@ -0,0 +1,228 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX512_IMPL_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX512_IMPL_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/goldilocks64.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/babybear.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/m31.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_avx2_impl.hpp>
+
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    template<typename WordArithmetic>
+                    struct word_batch_avx512_impl : public word_batch_avx2_impl<WordArithmetic> { };
+
+                    template<>
+                    struct word_batch_avx512_impl<goldilocks64_word_arithmetic> {
+                        typedef goldilocks64_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_avx2_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 8;
+
+                        static inline __m512i canonicalize(__m512i value) {
+                            const __m512i p = _mm512_set1_epi64(arithmetic_type::modulus);
+                            return _mm512_mask_sub_epi64(value, _mm512_cmpge_epu64_mask(value, p), value, p);
+                        }
+
+                        static inline __m512i add(__m512i a, __m512i b) {
+                            const __m512i epsilon = _mm512_set1_epi64(arithmetic_type::epsilon);
+                            __m512i sum = _mm512_add_epi64(a, b);
+                            sum = _mm512_mask_add_epi64(sum, _mm512_cmplt_epu64_mask(sum, a), sum, epsilon);
+                            return canonicalize(sum);
+                        }
+
+                        static inline __m512i mul(__m512i a, __m512i b) {
+                            const __m512i epsilon = _mm512_set1_epi64(arithmetic_type::epsilon);
+                            const __m512i a_hi = _mm512_srli_epi64(a, 32);
+                            const __m512i b_hi = _mm512_srli_epi64(b, 32);
+
+                            const __m512i ll = _mm512_mul_epu32(a, b);
+                            const __m512i lh = _mm512_mul_epu32(a, b_hi);
+                            const __m512i hl = _mm512_mul_epu32(a_hi, b);
+                            const __m512i hh = _mm512_mul_epu32(a_hi, b_hi);
+
+                            const __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+                            const __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, epsilon));
+                            const __m512i lo = _mm512_or_si512(_mm512_slli_epi64(u, 32), _mm512_and_si512(ll, epsilon));
+                            const __m512i hi =
+                                _mm512_add_epi64(hh, _mm512_add_epi64(_mm512_srli_epi64(t, 32), _mm512_srli_epi64(u, 32)));
+
+                            const __m512i hi_hi = _mm512_srli_epi64(hi, 32);
+                            const __m512i hi_lo = _mm512_and_si512(hi, epsilon);
+                            __m512i t0 = _mm512_sub_epi64(lo, hi_hi);
+                            t0 = _mm512_mask_sub_epi64(t0, _mm512_cmplt_epu64_mask(lo, hi_hi), t0, epsilon);
+                            const __m512i t1 = _mm512_mul_epu32(hi_lo, epsilon);
+                            __m512i t2 = _mm512_add_epi64(t0, t1);
+                            t2 = _mm512_mask_add_epi64(t2, _mm512_cmplt_epu64_mask(t2, t1), t2, epsilon);
+                            return canonicalize(t2);
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+
+                    template<>
+                    struct word_batch_avx512_impl<babybear_word_arithmetic> {
+                        typedef babybear_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_avx2_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 16;
+
+                        static inline __m512i add(__m512i a, __m512i b) {
+                            const __m512i p = _mm512_set1_epi32(arithmetic_type::modulus);
+                            const __m512i sum = _mm512_add_epi32(a, b);
+                            return _mm512_min_epu32(sum, _mm512_sub_epi32(sum, p));
+                        }
+
+                        static inline __m512i montgomery_mul(__m512i a, __m512i b) {
+                            const __m512i p = _mm512_set1_epi32(arithmetic_type::modulus);
+                            const __m512i mu = _mm512_set1_epi32(arithmetic_type::montgomery_inverse);
+
+                            const __m512i x_evn = _mm512_mul_epu32(a, b);
+                            const __m512i x_odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+                            const __m512i qp_evn = _mm512_mul_epu32(_mm512_mul_epu32(x_evn, mu), p);
+                            const __m512i qp_odd = _mm512_mul_epu32(_mm512_mul_epu32(x_odd, mu), p);
+
+                            const __m512i d_evn = _mm512_srli_epi64(_mm512_sub_epi64(x_evn, qp_evn), 32);
+                            const __m512i d_odd = _mm512_sub_epi64(x_odd, qp_odd);
+                            const __m512i d = _mm512_mask_blend_epi32(0xAAAA, d_evn, d_odd);
+                            return _mm512_min_epu32(d, _mm512_add_epi32(d, p));
+                        }
+
+                        static inline __m512i mul(__m512i a, __m512i b) {
+                            const __m512i r2 = _mm512_set1_epi32(arithmetic_type::montgomery_r2);
+                            return montgomery_mul(montgomery_mul(a, b), r2);
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+
+                    template<>
+                    struct word_batch_avx512_impl<m31_word_arithmetic> {
+                        typedef m31_word_arithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+                        typedef word_batch_avx2_impl<arithmetic_type> tail_type;
+
+                        constexpr static const std::size_t lanes = 16;
+
+                        static inline __m512i add(__m512i a, __m512i b) {
+                            const __m512i p = _mm512_set1_epi32(arithmetic_type::modulus);
+                            const __m512i sum = _mm512_add_epi32(a, b);
+                            return _mm512_min_epu32(sum, _mm512_sub_epi32(sum, p));
+                        }
+
+                        static inline __m512i mul(__m512i a, __m512i b) {
+                            const __m512i p = _mm512_set1_epi32(arithmetic_type::modulus);
+                            const __m512i p64 = _mm512_set1_epi64(arithmetic_type::modulus);
+
+                            const __m512i x_evn = _mm512_mul_epu32(a, b);
+                            const __m512i x_odd = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+
+                            const __m512i t_evn = _mm512_add_epi64(_mm512_and_si512(x_evn, p64), _mm512_srli_epi64(x_evn, 31));
+                            const __m512i t_odd = _mm512_add_epi64(_mm512_and_si512(x_odd, p64), _mm512_srli_epi64(x_odd, 31));
+                            __m512i t = _mm512_mask_blend_epi32(0xAAAA, t_evn, _mm512_slli_epi64(t_odd, 32));
+
+                            t = _mm512_add_epi32(_mm512_and_si512(t, p), _mm512_srli_epi32(t, 31));
+                            return _mm512_min_epu32(t, _mm512_sub_epi32(t, p));
+                        }
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, add(va, vb));
+                            }
+                            tail_type::add(result + i, a + i, b + i, size - i);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            std::size_t i = 0;
+                            for (; i + lanes <= size; i += lanes) {
+                                const __m512i va = _mm512_loadu_si512(a + i);
+                                const __m512i vb = _mm512_loadu_si512(b + i);
+                                _mm512_storeu_si512(result + i, mul(va, vb));
+                            }
+                            tail_type::mul(result + i, a + i, b + i, size - i);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_AVX512_IMPL_HPP
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_FUNCTIONS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_FUNCTIONS_HPP
+
+#include <boost/predef/architecture.h>
+#include <boost/predef/hardware/simd.h>
+
+#if defined(CRYPTO3_HAS_FIELDS_AVX512) || ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(__AVX512F__))
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_avx512_impl.hpp>
+#elif defined(CRYPTO3_HAS_FIELDS_AVX2) || \
+    ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_AVX2_VERSION)
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_avx2_impl.hpp>
+#else
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/batch_impl.hpp>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    template<typename WordArithmetic>
+                    struct word_batch_functions {
+                        typedef WordArithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+
+#if defined(CRYPTO3_HAS_FIELDS_AVX512) || ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && defined(__AVX512F__))
+                        typedef word_batch_avx512_impl<arithmetic_type> impl_type;
+#elif defined(CRYPTO3_HAS_FIELDS_AVX2) || \
+    ((BOOST_ARCH_X86_32 || BOOST_ARCH_X86_64) && BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_AVX2_VERSION)
+                        typedef word_batch_avx2_impl<arithmetic_type> impl_type;
+#else
+                        typedef word_batch_impl<arithmetic_type> impl_type;
+#endif
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            impl_type::add(result, a, b, size);
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            impl_type::mul(result, a, b, size);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_FUNCTIONS_HPP
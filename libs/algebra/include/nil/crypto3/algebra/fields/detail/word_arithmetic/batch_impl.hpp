@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_IMPL_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_IMPL_HPP
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * @brief Portable element-wise kernels over arrays of canonical words.
+                     * Vectorized implementations process full registers and defer the tail to these loops.
+                     */
+                    template<typename WordArithmetic>
+                    struct word_batch_impl {
+                        typedef WordArithmetic arithmetic_type;
+                        typedef typename arithmetic_type::word_type word_type;
+
+                        static inline void add(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            for (std::size_t i = 0; i < size; ++i) {
+                                result[i] = arithmetic_type::add(a[i], b[i]);
+                            }
+                        }
+
+                        static inline void mul(word_type *result, const word_type *a, const word_type *b,
+                                               std::size_t size) {
+                            for (std::size_t i = 0; i < size; ++i) {
+                                result[i] = arithmetic_type::mul(a[i], b[i]);
+                            }
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_BATCH_IMPL_HPP
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_GOLDILOCKS64_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_GOLDILOCKS64_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * @brief Native arithmetic modulo p = 2^64 - 2^32 + 1 on canonical 64-bit words.
+                     * Reduction uses 2^64 = 2^32 - 1 (mod p) and 2^96 = -1 (mod p), so a 128-bit
+                     * product is folded with one subtraction, one 32x32 multiplication and one addition.
+                     */
+                    struct goldilocks64_word_arithmetic {
+                        typedef std::uint64_t word_type;
+
+                        constexpr static const word_type modulus = UINT64_C(0xFFFFFFFF00000001);
+                        // 2^64 - p = 2^32 - 1
+                        constexpr static const word_type epsilon = UINT64_C(0xFFFFFFFF);
+
+                        constexpr static const std::size_t two_adicity = 32;
+                        constexpr static const word_type two_adic_odd_factor = UINT64_C(0xFFFFFFFF);
+                        constexpr static const word_type quadratic_nonresidue = 7;
+
+                        constexpr static inline word_type reduce(std::uint64_t value) {
+                            return value >= modulus ? value - modulus : value;
+                        }
+
+                        constexpr static inline word_type add(word_type a, word_type b) {
+                            word_type sum = a + b;
+                            if (sum < a) {
+                                // a + b - 2^64 + epsilon = a + b - p < p
+                                sum += epsilon;
+                            }
+                            return reduce(sum);
+                        }
+
+                        constexpr static inline word_type sub(word_type a, word_type b) {
+                            word_type diff = a - b;
+                            if (a < b) {
+                                diff -= epsilon;
+                            }
+                            return diff;
+                        }
+
+                        constexpr static inline word_type neg(word_type a) {
+                            return a == 0 ? 0 : modulus - a;
+                        }
+
+                        constexpr static inline word_type reduce128(std::uint64_t lo, std::uint64_t hi) {
+                            const std::uint64_t hi_hi = hi >> 32;
+                            const std::uint64_t hi_lo = hi & epsilon;
+
+                            // hi_hi * 2^96 = -hi_hi (mod p)
+                            std::uint64_t t0 = lo - hi_hi;
+                            if (lo < hi_hi) {
+                                t0 -= epsilon;
+                            }
+                            // hi_lo * 2^64 = hi_lo * (2^32 - 1) (mod p), fits into 64 bits
+                            const std::uint64_t t1 = hi_lo * epsilon;
+                            std::uint64_t t2 = t0 + t1;
+                            if (t2 < t1) {
+                                t2 += epsilon;
+                            }
+                            return reduce(t2);
+                        }
+
+                        constexpr static inline word_type mul(word_type a, word_type b) {
+                            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+                            return reduce128(static_cast<std::uint64_t>(product),
+                                             static_cast<std::uint64_t>(product >> 64));
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_GOLDILOCKS64_HPP
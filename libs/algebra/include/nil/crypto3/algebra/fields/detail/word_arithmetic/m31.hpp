@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_M31_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_M31_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /**
+                     * @brief Native arithmetic modulo the Mersenne prime p = 2^31 - 1 on canonical 32-bit words.
+                     * Reduction folds the bits above 31 back using 2^31 = 1 (mod p).
+                     * fields::m31 does not use it yet: its modulus and arithmetic params are not those of
+                     * 2^31 - 1, and the placeholder tests over it depend on them.
+                     */
+                    struct m31_word_arithmetic {
+                        typedef std::uint32_t word_type;
+
+                        constexpr static const word_type modulus = 0x7FFFFFFFu;
+
+                        constexpr static const std::size_t two_adicity = 1;
+                        constexpr static const word_type two_adic_odd_factor = 0x3FFFFFFFu;
+                        // p = 3 (mod 4), so -1 is not a square
+                        constexpr static const word_type quadratic_nonresidue = 0x7FFFFFFEu;
+
+                        constexpr static inline word_type reduce(std::uint64_t value) {
+                            // value < 2^64 -> less than 2^34 -> less than 2^31 + 2^3
+                            value = (value & modulus) + (value >> 31);
+                            value = (value & modulus) + (value >> 31);
+                            return static_cast<word_type>(value >= modulus ? value - modulus : value);
+                        }
+
+                        constexpr static inline word_type add(word_type a, word_type b) {
+                            const word_type sum = a + b;
+                            return sum >= modulus ? sum - modulus : sum;
+                        }
+
+                        constexpr static inline word_type sub(word_type a, word_type b) {
+                            return a >= b ? a - b : a + (modulus - b);
+                        }
+
+                        constexpr static inline word_type neg(word_type a) {
+                            return a == 0 ? 0 : modulus - a;
+                        }
+
+                        constexpr static inline word_type mul(word_type a, word_type b) {
+                            return reduce(static_cast<std::uint64_t>(a) * b);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_DETAIL_WORD_ARITHMETIC_M31_HPP
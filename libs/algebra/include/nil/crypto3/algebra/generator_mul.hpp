@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_GENERATOR_MUL_HPP
+#define CRYPTO3_ALGEBRA_GENERATOR_MUL_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/batch_affine.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                // short Weierstrass points in jacobian or projective coordinates can be stored with Z = 1
+                // and added with mixed_add
+                template<typename CurveElementType>
+                struct is_mixed_addable
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<typename CurveElementType::form, curves::forms::short_weierstrass>::value &&
+                              !std::is_same<typename CurveElementType::coordinates,
+                                            curves::coordinates::affine>::value> { };
+
+                /** @brief Adds a point with Z = 1 to the sum through mixed_add.
+                 *
+                 *  The mixed addition formulas yield O for equal inputs instead of the doubled point. That only
+                 *  happens when the sum turns zero, so the inputs are compared in that rare case alone.
+                 */
+                template<typename CurveElementType>
+                void checked_mixed_add(CurveElementType &result, const CurveElementType &point) {
+                    const CurveElementType previous = result;
+                    result.mixed_add(point);
+                    if (result.is_zero() && previous == point) {
+                        result = point;
+                        result.double_inplace();
+                    }
+                }
+
+                /** @brief Fixed-base window table for multiplication of a single base by arbitrary scalars.
+                 *
+                 *  The scalar is recoded into signed digits d_k in [-2^(w - 1), 2^(w - 1)], and the table
+                 *  holds j * 2^(wk) * base for j in [1, 2^(w - 1)] and every window k, so a multiplication
+                 *  costs one addition per window and no doublings.
+                 *  The table entry read at every window depends on the scalar, so neither the memory access
+                 *  pattern nor the running time is constant: the table gives no protection against timing or
+                 *  cache side channels, secret scalars included.
+                 *  @tparam GroupType group of the base
+                 *  @tparam WindowBits window width w
+                 */
+                template<typename GroupType, std::size_t WindowBits = 5>
+                class fixed_base_table {
+                public:
+                    typedef typename GroupType::value_type value_type;
+                    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                    typedef typename scalar_field_type::value_type scalar_value_type;
+                    typedef typename scalar_field_type::integral_type integral_type;
+
+                    constexpr static const std::size_t window_bits = WindowBits;
+                    constexpr static const std::size_t scalar_bits = scalar_field_type::modulus_bits;
+                    // one extra window absorbs the carry out of the topmost full window
+                    constexpr static const std::size_t windows = scalar_bits / window_bits + 1;
+                    constexpr static const std::size_t half_window = std::size_t(1) << (window_bits - 1);
+
+                    explicit fixed_base_table(const value_type &base) : table(windows * half_window) {
+                        value_type window_base = base;
+                        for (std::size_t k = 0; k < windows; ++k) {
+                            value_type *row = table.data() + k * half_window;
+                            row[0] = window_base;
+                            for (std::size_t j = 1; j < half_window; ++j) {
+                                row[j] = row[j - 1] + window_base;
+                            }
+                            // 2^w * window_base = 2 * (2^(w - 1) * window_base)
+                            window_base = row[half_window - 1];
+                            window_base.double_inplace();
+                        }
+                        normalize(std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+                    }
+
+                    value_type mul(const scalar_value_type &scalar) const {
+                        const integral_type s(scalar.data);
+
+                        value_type result = value_type::zero();
+                        std::int32_t carry = 0;
+                        for (std::size_t k = 0; k < windows; ++k) {
+                            std::int32_t digit = carry;
+                            for (std::size_t j = 0; j < window_bits && k * window_bits + j < scalar_bits; ++j) {
+                                if (boost::multiprecision::bit_test(s, k * window_bits + j)) {
+                                    digit += std::int32_t(1) << j;
+                                }
+                            }
+                            carry = 0;
+                            if (digit > std::int32_t(half_window)) {
+                                digit -= std::int32_t(1) << window_bits;
+                                carry = 1;
+                            }
+
+                            if (digit > 0) {
+                                add(result, table[k * half_window + digit - 1],
+                                    std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+                            } else if (digit < 0) {
+                                add(result, -table[k * half_window - digit - 1],
+                                    std::integral_constant<bool, is_mixed_addable<value_type>::value>());
+                            }
+                        }
+                        return result;
+                    }
+
+                private:
+                    void normalize(std::true_type) {
+                        batch_normalize(table);
+                    }
+
+                    void normalize(std::false_type) {
+                    }
+
+                    static void add(value_type &result, const value_type &point, std::true_type) {
+                        checked_mixed_add(result, point);
+                    }
+
+                    static void add(value_type &result, const value_type &point, std::false_type) {
+                        result += point;
+                    }
+
+                    std::vector<value_type> table;
+                };
+            }    // namespace detail
+
+            /** @brief Multiplies the generator one() of the group by a scalar.
+             *
+             *  Uses a window table of multiples of the generator that is built on the first call for the
+             *  group and shared by all later calls, which is several times faster than scalar * one().
+             *  The running time and the table accesses depend on the scalar, as with the generic scalar
+             *  multiplication, so the function is not constant-time, also when used for signing.
+             */
+            template<typename GroupType>
+            typename GroupType::value_type
+                generator_mul(const typename GroupType::curve_type::scalar_field_type::value_type &scalar) {
+                static const detail::fixed_base_table<GroupType> table(GroupType::value_type::one());
+                return table.mul(scalar);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_GENERATOR_MUL_HPP
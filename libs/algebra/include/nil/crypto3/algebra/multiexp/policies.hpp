@@ -28,6 +28,12 @@
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
 #include <vector>
+#include <cstdint>
+#include <limits>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
 
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
@@ -54,6 +60,74 @@ namespace nil {
                             return (this->r < other.r);
                         }
                     };
+
+                    /**
+                     * Picks the window size c for multiexp_method_pippenger minimizing the estimated number of
+                     * group additions: every one of the num_bits / c + 1 windows costs one addition per base plus
+                     * two additions per bucket (2^(c - 1) buckets) to sum the buckets up.
+                     */
+                    inline std::size_t pippenger_window_size(const std::size_t length, const std::size_t num_bits) {
+#ifdef LOWMEM
+                        constexpr std::size_t max_window = 14;
+#else
+                        constexpr std::size_t max_window = 18;
+#endif
+                        std::size_t best_window = 1;
+                        std::size_t best_cost = std::numeric_limits<std::size_t>::max();
+                        for (std::size_t c = 1; c <= max_window; ++c) {
+                            const std::size_t cost = (num_bits / c + 1) * (length + (std::size_t(1) << c));
+                            if (cost < best_cost) {
+                                best_cost = cost;
+                                best_window = c;
+                            }
+                        }
+                        return best_window;
+                    }
+
+                    /**
+                     * Sums digits[i] * bases[i] over i in [begin, end) for signed window digits
+                     * |digits[i]| <= 2^(c - 1), using 2^(c - 1) buckets.
+                     * When compiled with USE_MIXED_ADDITION, assumes bases are in special form.
+                     */
+                    template<typename InputBaseIterator>
+                    typename std::iterator_traits<InputBaseIterator>::value_type
+                        pippenger_window_sum(InputBaseIterator bases,
+                                             const std::int32_t *digits,
+                                             const std::size_t begin,
+                                             const std::size_t end,
+                                             const std::size_t c) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                        std::vector<base_value_type> buckets(std::size_t(1) << (c - 1), base_value_type::zero());
+
+                        for (std::size_t i = begin; i < end; ++i) {
+                            const std::int32_t digit = digits[i];
+                            if (digit > 0) {
+#ifdef USE_MIXED_ADDITION
+                                buckets[digit - 1].mixed_add(bases[i]);
+#else
+                                buckets[digit - 1] += bases[i];
+#endif
+                            } else if (digit < 0) {
+#ifdef USE_MIXED_ADDITION
+                                buckets[-digit - 1].mixed_add(-bases[i]);
+#else
+                                buckets[-digit - 1] -= bases[i];
+#endif
+                            }
+                        }
+
+                        // sum_j (j + 1) * buckets[j] computed as the sum of running suffix sums
+                        base_value_type running_sum = base_value_type::zero();
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t j = buckets.size(); j > 0; --j) {
+                            running_sum += buckets[j - 1];
+                            result += running_sum;
+                        }
+
+                        return result;
+                    }
                 }    // namespace detail
 
                 /**
@@ -202,6 +276,117 @@ namespace nil {
                     }
                 };
 
+                /**
+                 * Pippenger's bucket method with signed window digits, see e.g.
+                 * Bootle, Cerulli, Chaidos, Groth, Petit, "Efficient Zero-Knowledge Arguments for Arithmetic
+                 * Circuits in the Discrete Log Setting", EUROCRYPT 2016, Appendix A
+                 * (https://eprint.iacr.org/2016/263.pdf)
+                 * Every scalar is recoded into digits in [-2^(c - 1), 2^(c - 1)], so each window needs only
+                 * 2^(c - 1) buckets and negating a base is free. The window size c is picked by
+                 * detail::pippenger_window_size.
+                 * If MULTICORE is defined, the (window, range of bases) pairs are distributed with OpenMP, the
+                 * number of threads is controlled with OMP_NUM_THREADS env var or omp_set_num_threads().
+                 * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
+                 */
+                struct multiexp_method_pippenger {
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator bases,
+                                InputBaseIterator bases_end,
+                                InputFieldIterator exponents,
+                                InputFieldIterator exponents_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+                        typedef typename std::iterator_traits<InputFieldIterator>::value_type field_value_type;
+                        typedef typename field_value_type::integral_type integral_type;
+
+                        const std::size_t length = std::distance(bases, bases_end);
+                        BOOST_ASSERT(length == std::size_t(std::distance(exponents, exponents_end)));
+
+                        if (length == 0) {
+                            return base_value_type::zero();
+                        }
+
+                        std::vector<integral_type> scalars(length);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t i = 0; i < length; ++i) {
+                            scalars[i] = integral_type(exponents[i].data);
+                        }
+
+                        std::size_t num_bits = 1;
+                        for (std::size_t i = 0; i < length; ++i) {
+                            // boost::multiprecision::msb doesn't work for zero value
+                            if (!scalars[i].is_zero()) {
+                                num_bits = std::max(num_bits, std::size_t(boost::multiprecision::msb(scalars[i]) + 1));
+                            }
+                        }
+
+                        const std::size_t c = detail::pippenger_window_size(length, num_bits);
+                        // one extra window absorbs the carry out of the topmost full window
+                        const std::size_t num_windows = num_bits / c + 1;
+                        const std::int32_t half_window = std::int32_t(1) << (c - 1);
+
+                        // digits of window k are stored contiguously starting at digits[k * length]
+                        std::vector<std::int32_t> digits(num_windows * length);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t i = 0; i < length; ++i) {
+                            std::int32_t carry = 0;
+                            for (std::size_t k = 0; k < num_windows; ++k) {
+                                std::int32_t digit = carry;
+                                for (std::size_t j = 0; j < c && k * c + j < num_bits; ++j) {
+                                    if (boost::multiprecision::bit_test(scalars[i], k * c + j)) {
+                                        digit += std::int32_t(1) << j;
+                                    }
+                                }
+                                carry = 0;
+                                if (k + 1 < num_windows && digit >= half_window) {
+                                    digit -= std::int32_t(1) << c;
+                                    carry = 1;
+                                }
+                                digits[k * length + i] = digit;
+                            }
+                        }
+
+                        std::size_t ranges_count = 1;
+#ifdef MULTICORE
+                        const std::size_t threads = omp_get_max_threads();
+                        if (threads > num_windows) {
+                            ranges_count = std::min(length, (threads + num_windows - 1) / num_windows);
+                        }
+#endif
+
+                        std::vector<base_value_type> partial_sums(num_windows * ranges_count);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+                        for (std::size_t job = 0; job < num_windows * ranges_count; ++job) {
+                            const std::size_t k = job / ranges_count, range = job % ranges_count;
+                            partial_sums[job] =
+                                detail::pippenger_window_sum(bases, digits.data() + k * length,
+                                                             range * length / ranges_count,
+                                                             (range + 1) * length / ranges_count, c);
+                        }
+
+                        base_value_type result = base_value_type::zero();
+                        for (std::size_t k = num_windows; k > 0; --k) {
+                            if (!result.is_zero()) {
+                                for (std::size_t i = 0; i < c; ++i) {
+                                    result.double_inplace();
+                                }
+                            }
+                            for (std::size_t range = 0; range < ranges_count; ++range) {
+                                result += partial_sums[(k - 1) * ranges_count + range];
+                            }
+                        }
+
+                        return result;
+                    }
+                };
+
                 /**
                  * A variant of the Bos-Coster algorithm [1],
                  * with implementation suggestions from [2].
@@ -61,6 +61,7 @@
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/batch_affine.hpp>
 
 using namespace nil::crypto3::algebra;
 
@@ -193,6 +194,72 @@ void curve_operations_perf_test(std::string const& curve_name) {
     }
 }
 
+template<typename CurveGroup>
+void batch_affine_perf_test(std::string const& curve_name) {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    typedef typename CurveGroup::value_type value_type;
+    typedef decltype(std::declval<value_type>().to_affine()) affine_value_type;
+
+    using duration = std::chrono::duration<double, std::nano>;
+
+    for (std::size_t size : {16, 256, 4096}) {
+        std::vector<value_type> points;
+        for (std::size_t i = 0; i < size; ++i) {
+            points.push_back(algebra::random_element<CurveGroup>());
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<affine_value_type> single_affine;
+        for (std::size_t i = 0; i < size; ++i) {
+            single_affine.push_back(points[i].to_affine());
+        }
+        duration single_to_affine = (std::chrono::high_resolution_clock::now() - start) * 1.0 / size;
+
+        start = std::chrono::high_resolution_clock::now();
+        std::vector<affine_value_type> batched_affine = batch_to_affine(points);
+        duration batched_to_affine = (std::chrono::high_resolution_clock::now() - start) * 1.0 / size;
+
+        BOOST_CHECK(single_affine == batched_affine);
+
+        std::vector<affine_value_type> others(batched_affine.rbegin(), batched_affine.rend());
+
+        start = std::chrono::high_resolution_clock::now();
+        std::vector<affine_value_type> single_sums(batched_affine);
+        for (std::size_t i = 0; i < size; ++i) {
+            single_sums[i] += others[i];
+        }
+        duration single_add = (std::chrono::high_resolution_clock::now() - start) * 1.0 / size;
+
+        start = std::chrono::high_resolution_clock::now();
+        std::vector<affine_value_type> batched_sums(batched_affine);
+        batch_affine_add(batched_sums, others);
+        duration batched_add = (std::chrono::high_resolution_clock::now() - start) * 1.0 / size;
+
+        BOOST_CHECK(single_sums == batched_sums);
+
+        std::cout << curve_name << " batch of " << size << std::fixed << std::setprecision(3)
+                  << ": to_affine " << single_to_affine.count() << " ns, batch_to_affine "
+                  << batched_to_affine.count() << " ns, affine add " << single_add.count()
+                  << " ns, batch_affine_add " << batched_add.count() << " ns per point" << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(perf_test_batch_affine) {
+    batch_affine_perf_test<nil::crypto3::algebra::curves::bls12<381>::g1_type<
+        nil::crypto3::algebra::curves::coordinates::jacobian_with_a4_0,
+        nil::crypto3::algebra::curves::forms::short_weierstrass>>("bls12-381-j0");
+
+    batch_affine_perf_test<nil::crypto3::algebra::curves::pallas::g1_type<
+        nil::crypto3::algebra::curves::coordinates::jacobian_with_a4_0,
+        nil::crypto3::algebra::curves::forms::short_weierstrass>>("pallas-j0");
+
+    batch_affine_perf_test<nil::crypto3::algebra::curves::mnt4<298>::g1_type<
+        nil::crypto3::algebra::curves::coordinates::projective,
+        nil::crypto3::algebra::curves::forms::short_weierstrass>>("mnt4-p");
+}
+
 BOOST_AUTO_TEST_CASE(perf_test_bls12_381_g1) {
     using policy_type = nil::crypto3::algebra::curves::bls12<381>::g1_type<
         nil::crypto3::algebra::curves::coordinates::jacobian_with_a4_0,
@@ -53,9 +53,13 @@
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/double_scalar_mul.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
 using namespace nil::crypto3::algebra;
 
 namespace boost {
@@ -408,6 +412,71 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+template<typename CurveGroup>
+void check_generator_mul() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using group_value_type = typename CurveGroup::value_type;
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              scalar_value_type(2), -scalar_value_type::one(),
+                                              -scalar_value_type(2)};
+    nil::crypto3::random::algebraic_random_device<scalar_field_type> rnd;
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(rnd());
+    }
+
+    for (const auto &scalar : scalars) {
+        BOOST_CHECK(generator_mul<CurveGroup>(scalar) == scalar * group_value_type::one());
+    }
+}
+
+template<typename CurveGroup>
+void check_double_scalar_mul() {
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using group_value_type = typename CurveGroup::value_type;
+
+    nil::crypto3::random::algebraic_random_device<scalar_field_type> rnd;
+    const group_value_type P = group_value_type::one();
+    const group_value_type Q = scalar_value_type(rnd()) * P;
+
+    std::vector<std::pair<scalar_value_type, scalar_value_type>> scalars = {
+        {scalar_value_type::zero(), scalar_value_type::zero()},
+        {scalar_value_type::one(), scalar_value_type::zero()},
+        {scalar_value_type::zero(), -scalar_value_type::one()},
+        {-scalar_value_type::one(), -scalar_value_type(2)}};
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(rnd(), rnd());
+    }
+
+    for (const auto &ab : scalars) {
+        BOOST_CHECK(double_scalar_mul<CurveGroup>(ab.first, P, ab.second, Q) == ab.first * P + ab.second * Q);
+    }
+    BOOST_CHECK(double_scalar_mul<CurveGroup>(scalar_value_type(3), group_value_type::zero(), scalar_value_type(5),
+                                              Q) == scalar_value_type(5) * Q);
+    BOOST_CHECK(double_scalar_mul<CurveGroup>(scalar_value_type(3), Q, -scalar_value_type(3), Q).is_zero());
+
+    // equal and small multiple bases share table entries
+    for (std::size_t k = 1; k <= 4; ++k) {
+        const group_value_type R = scalar_value_type(k) * P;
+        std::vector<std::pair<scalar_value_type, scalar_value_type>> related_scalars = {
+            {scalar_value_type::one(), scalar_value_type::one()},
+            {scalar_value_type(3), scalar_value_type(3)},
+            {scalar_value_type(k), scalar_value_type::one()},
+            {scalar_value_type(3 * k), scalar_value_type(3)}};
+        for (std::size_t i = 0; i < 8; ++i) {
+            const scalar_value_type a = rnd();
+            related_scalars.emplace_back(a, a);
+            related_scalars.emplace_back(rnd(), rnd());
+        }
+        for (const auto &ab : related_scalars) {
+            BOOST_CHECK(double_scalar_mul<CurveGroup>(ab.first, P, ab.second, R) ==
+                        (ab.first + scalar_value_type(k) * ab.second) * P);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 /**/
 
@@ -617,3 +686,84 @@ BOOST_DATA_TEST_CASE(curve_operation_test_edwards_g2, string_data("curve_operati
     }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(curves_generator_mul_tests)
+
+    BOOST_AUTO_TEST_CASE(generator_mul_secp256_k1_g1) {
+        check_generator_mul<curves::secp_k1<256>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_secp256_r1_g1) {
+        check_generator_mul<curves::secp_r1<256>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_bls12_381_g1) {
+        check_generator_mul<curves::bls12<381>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_bls12_381_g2) {
+        check_generator_mul<curves::bls12<381>::g2_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_pallas_g1) {
+        check_generator_mul<curves::pallas::g1_type<>>();
+    }
+
+    // 2^255 = 2^254 - (q - 2^254) mod q: after window 50 the running sum equals the 16 * 2^250 * G table entry
+    BOOST_AUTO_TEST_CASE(generator_mul_pallas_equal_table_entry) {
+        typedef curves::pallas::g1_type<> group_type;
+        typedef group_type::curve_type::scalar_field_type::value_type scalar_value_type;
+
+        const scalar_value_type scalar = scalar_value_type(2).pow(255);
+        BOOST_CHECK(generator_mul<group_type>(scalar) == scalar * group_type::value_type::one());
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_ed25519_g1) {
+        check_generator_mul<curves::ed25519::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_jubjub_g1) {
+        check_generator_mul<curves::jubjub::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(generator_mul_babyjubjub_g1) {
+        check_generator_mul<curves::babyjubjub::g1_type<>>();
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(curves_double_scalar_mul_tests)
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_secp256_k1_g1) {
+        check_double_scalar_mul<curves::secp_k1<256>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_secp256_r1_g1) {
+        check_double_scalar_mul<curves::secp_r1<256>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_bls12_381_g1) {
+        check_double_scalar_mul<curves::bls12<381>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_bls12_381_g2) {
+        check_double_scalar_mul<curves::bls12<381>::g2_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_alt_bn128_254_g1) {
+        check_double_scalar_mul<curves::alt_bn128<254>::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_pallas_g1) {
+        check_double_scalar_mul<curves::pallas::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_vesta_g1) {
+        check_double_scalar_mul<curves::vesta::g1_type<>>();
+    }
+
+    BOOST_AUTO_TEST_CASE(double_scalar_mul_ed25519_g1) {
+        check_double_scalar_mul<curves::ed25519::g1_type<>>();
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
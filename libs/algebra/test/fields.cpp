@@ -26,8 +26,11 @@
 
 #define BOOST_TEST_MODULE algebra_fields_test
 
+#include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <type_traits>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -60,6 +63,10 @@
 #include <nil/crypto3/algebra/fields/goldilocks64/base_field.hpp>
 #include <nil/crypto3/algebra/fields/babybear/base_field.hpp>
 #include <nil/crypto3/algebra/fields/m31/base_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/goldilocks64.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/babybear.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/m31.hpp>
+#include <nil/crypto3/algebra/fields/detail/word_arithmetic/m31.hpp>
 #include <nil/crypto3/algebra/fields/maxprime.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
@@ -73,6 +80,8 @@
 #include <nil/crypto3/algebra/curves/secp_k1.hpp>
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
 
+#include <nil/crypto3/algebra/batch_arithmetic.hpp>
+
 using namespace nil::crypto3::algebra;
 
 namespace boost {
@@ -648,3 +657,139 @@ BOOST_AUTO_TEST_CASE(field_not_square_test_secp_r1) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+template<typename FieldType>
+void word_field_arithmetic_test() {
+    using value_type = typename FieldType::value_type;
+    using integral_type = typename FieldType::integral_type;
+    using extended_integral_type = typename FieldType::extended_integral_type;
+
+    const value_type minus_one = value_type(FieldType::modulus - 1u);
+    BOOST_CHECK_EQUAL(minus_one, -value_type::one());
+    BOOST_CHECK(minus_one * minus_one == value_type::one());
+    BOOST_CHECK(value_type(FieldType::modulus).is_zero());
+    BOOST_CHECK(integral_type(value_type(-5).data) == FieldType::modulus - 5u);
+
+    // root_of_unity generates the subgroup of order 2^s
+    const value_type root = value_type(fields::arithmetic_params<FieldType>::root_of_unity);
+    value_type root_pow = root;
+    for (std::size_t i = 1; i < fields::arithmetic_params<FieldType>::s; ++i) {
+        BOOST_CHECK(!root_pow.is_one());
+        root_pow.square_inplace();
+    }
+    BOOST_CHECK(root_pow == minus_one);
+
+    // Fixed LCG so that the vectorized and the scalar paths see the same values, odd size covers the tail
+    const std::size_t size = 77;
+    std::vector<value_type> a(size), b(size), sum(size), product(size);
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (std::size_t i = 0; i < size; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        a[i] = i == 0 ? minus_one : value_type(state);
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        b[i] = i == 0 ? minus_one : value_type(state);
+    }
+
+    algebra::batch_add(sum, a, b);
+    algebra::batch_mul(product, a, b);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(sum[i], a[i] + b[i]);
+        BOOST_CHECK_EQUAL(product[i], a[i] * b[i]);
+        BOOST_CHECK(product[i].data.template convert_to<extended_integral_type>() ==
+                    (a[i].data.template convert_to<extended_integral_type>() *
+                     b[i].data.template convert_to<extended_integral_type>()) %
+                        extended_integral_type(FieldType::modulus));
+        BOOST_CHECK_EQUAL(a[i] * a[i].inversed(), value_type::one());
+        BOOST_CHECK_EQUAL(a[i].squared().sqrt().squared(), a[i].squared());
+    }
+
+    algebra::batch_mul(a, a, b);
+    BOOST_CHECK(a == product);
+}
+
+// Uses of element_fp that must compile the same way for the generic and the word-sized elements
+template<typename FieldType>
+void element_fp_api_test() {
+    using value_type = typename FieldType::value_type;
+    using data_type = typename value_type::data_type;
+    using modular_type = typename value_type::modular_type;
+    using integral_type = typename FieldType::integral_type;
+
+    static_assert(std::is_same<decltype(std::declval<value_type &>()._2z_add_3x()), value_type>::value,
+                  "_2z_add_3x must return an element");
+
+    const value_type x = value_type(integral_type(123456789u)) * value_type(-7);
+    const integral_type x_integral = integral_type(x.data);
+
+    const data_type data = x.data;
+    const modular_type modular = x.data;
+    BOOST_CHECK(value_type(data) == x);
+    BOOST_CHECK(value_type(modular) == x);
+    BOOST_CHECK(data_type(modular) == data);
+    BOOST_CHECK(x.data.template convert_to<integral_type>() == x_integral);
+    BOOST_CHECK(modular.template convert_to<integral_type>() == x_integral);
+    BOOST_CHECK(x_integral == FieldType::modulus - integral_type(123456789u * 7u));
+    BOOST_CHECK(value_type::zero().data.is_zero());
+    BOOST_CHECK(!x.data.is_zero());
+
+    value_type y;
+    y.data = modular;
+    BOOST_CHECK(y == x);
+    BOOST_CHECK(std::hash<value_type>()(y) == std::hash<value_type>()(x));
+
+    std::ostringstream os;
+    os << x;
+    BOOST_CHECK(!os.str().empty());
+}
+
+BOOST_AUTO_TEST_SUITE(fields_word_arithmetic_tests)
+
+BOOST_AUTO_TEST_CASE(element_fp_api_test_goldilocks64) {
+    element_fp_api_test<fields::goldilocks64>();
+}
+
+BOOST_AUTO_TEST_CASE(element_fp_api_test_babybear) {
+    element_fp_api_test<fields::babybear>();
+}
+
+BOOST_AUTO_TEST_CASE(element_fp_api_test_m31) {
+    element_fp_api_test<fields::m31>();
+}
+
+BOOST_AUTO_TEST_CASE(field_word_arithmetic_test_goldilocks64) {
+    word_field_arithmetic_test<fields::goldilocks64>();
+}
+
+BOOST_AUTO_TEST_CASE(field_word_arithmetic_test_babybear) {
+    word_field_arithmetic_test<fields::babybear>();
+}
+
+BOOST_AUTO_TEST_CASE(field_word_arithmetic_test_m31) {
+    // fields::m31 keeps the generic element, the Mersenne kernels are checked on raw words
+    typedef fields::detail::m31_word_arithmetic arithmetic_type;
+    typedef arithmetic_type::word_type word_type;
+    const std::uint64_t modulus = arithmetic_type::modulus;
+
+    BOOST_CHECK_EQUAL(arithmetic_type::reduce(~std::uint64_t(0)), ~std::uint64_t(0) % modulus);
+    BOOST_CHECK_EQUAL(arithmetic_type::neg(1), modulus - 1);
+
+    const std::size_t size = 77;
+    std::vector<word_type> a(size), b(size), sum(size), product(size);
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (std::size_t i = 0; i < size; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        a[i] = i == 0 ? modulus - 1 : arithmetic_type::reduce(state);
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        b[i] = i == 0 ? modulus - 1 : arithmetic_type::reduce(state);
+    }
+
+    fields::detail::word_batch_functions<arithmetic_type>::add(sum.data(), a.data(), b.data(), size);
+    fields::detail::word_batch_functions<arithmetic_type>::mul(product.data(), a.data(), b.data(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(sum[i], (std::uint64_t(a[i]) + b[i]) % modulus);
+        BOOST_CHECK_EQUAL(product[i], (std::uint64_t(a[i]) * b[i]) % modulus);
+        BOOST_CHECK_EQUAL(arithmetic_type::sub(sum[i], b[i]), a[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_multiexp_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType, typename FieldType, typename MultiexpMethod>
+void check_multiexp_method(std::size_t size) {
+    using group_value_type = typename GroupType::value_type;
+    using field_value_type = typename FieldType::value_type;
+
+    std::vector<group_value_type> bases;
+    std::vector<field_value_type> scalars;
+    for (std::size_t i = 0; i < size; ++i) {
+        bases.push_back(random_element<GroupType>());
+        if (i % 7 == 3) {
+            // repeated bases end up in the same bucket
+            bases.back() = bases[i / 2];
+        }
+        if (i % 5 == 1) {
+            scalars.push_back(field_value_type::zero());
+        } else if (i % 5 == 2) {
+            scalars.push_back(-field_value_type::one());
+        } else {
+            scalars.push_back(random_element<FieldType>());
+        }
+    }
+
+    group_value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1);
+    BOOST_CHECK(expected == multiexp<MultiexpMethod>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1));
+    BOOST_CHECK(expected == multiexp<MultiexpMethod>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), 3));
+}
+
+template<typename GroupType, typename FieldType>
+void check_pippenger() {
+    for (std::size_t size : {1, 2, 5, 64, 300, 1024}) {
+        check_multiexp_method<GroupType, FieldType, policies::multiexp_method_pippenger>(size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
+
+BOOST_AUTO_TEST_CASE(pippenger_window_size_test) {
+    for (std::size_t log_length = 0; log_length <= 24; ++log_length) {
+        const std::size_t c = policies::detail::pippenger_window_size(std::size_t(1) << log_length, 255);
+        BOOST_CHECK(c >= 1);
+        BOOST_CHECK(c <= 18);
+    }
+    BOOST_CHECK(policies::detail::pippenger_window_size(1 << 20, 255) >
+                policies::detail::pippenger_window_size(1 << 10, 255));
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_bls12_381_g1) {
+    check_pippenger<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_bls12_381_g2) {
+    check_pippenger<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_alt_bn128_g1) {
+    check_pippenger<curves::alt_bn128<254>::g1_type<>, curves::alt_bn128<254>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(pippenger_pallas) {
+    check_pippenger<curves::pallas::g1_type<>, curves::pallas::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
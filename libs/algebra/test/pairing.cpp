@@ -28,6 +28,7 @@
 #define BOOST_TEST_MODULE algebra_curves_test
 
 #include <iostream>
+#include <utility>
 #include <vector>
 #include <array>
 
@@ -194,7 +195,24 @@ void check_pairing_operations(std::vector<Fr_value_type> const& Fr_elements,
                           miller_loop<CurveType>(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]),
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
+
+    std::vector<std::pair<g1_precomp_value_type, g2_precomp_value_type>> prec_pairs = {
+        {G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]}, {G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]}};
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs.begin(), prec_pairs.end()),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs.begin(), prec_pairs.begin() + 1),
+                      GT_elements[miller_loop_prec_A1_prec_B1]);
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(prec_pairs.begin(), prec_pairs.begin()), GT_value_type::one());
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi pairing tests started..." << std::endl;
+    std::vector<std::pair<G1_value_type, G2_value_type>> pairs = {{G1_elements[A1], G2_elements[B1]},
+                                                                   {G1_elements[A2], G2_elements[B2]}};
+    BOOST_CHECK_EQUAL(multi_pair_reduced<CurveType>(pairs.begin(), pairs.end()),
+                      GT_elements[pair_reduceding_A1_B1_mul_pair_reduceding_A2_B2]);
+    pairs = {{G1_elements[A1], G2_elements[B1]}, {-G1_elements[VKx], G2_elements[VKy]}, {-G1_elements[C1], G2_elements[VKz]}};
+    BOOST_CHECK_EQUAL(multi_pair_reduced<CurveType>(pairs.begin(), pairs.end()), GT_value_type::one());
+    std::cout << " * Multi pairing tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -38,6 +38,10 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+
+#include <nil/crypto3/algebra/batch_affine.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
 
@@ -131,8 +135,74 @@ void curve_operation_test(const TestSet &test_set,
     check_curve_operations<CurveGroup>(points, constants);
 }
 
+template<typename CurveGroup>
+void check_batch_affine_operations() {
+    using value_type = typename CurveGroup::value_type;
+    using field_value_type = typename value_type::field_type::value_type;
+    using affine_value_type = decltype(std::declval<value_type>().to_affine());
+
+    auto from_affine = [](const affine_value_type &p) {
+        return p.is_zero() ? value_type::zero() : value_type(p.X, p.Y, field_value_type::one());
+    };
+
+    const std::size_t size = 32;
+    std::vector<value_type> points;
+    for (std::size_t i = 0; i < size; ++i) {
+        points.emplace_back(i % 9 == 4 ? value_type::zero() : random_element<CurveGroup>());
+    }
+
+    std::vector<affine_value_type> affine_points = batch_to_affine(points);
+    BOOST_CHECK_EQUAL(affine_points.size(), size);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(affine_points[i].is_zero() == points[i].is_zero());
+        BOOST_CHECK(from_affine(affine_points[i]) == points[i]);
+    }
+
+    std::vector<value_type> normalized_points(points);
+    batch_normalize(normalized_points);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(normalized_points[i] == points[i]);
+        BOOST_CHECK(points[i].is_zero() || normalized_points[i].Z == field_value_type::one());
+    }
+
+    // generic additions, doublings, P + (-P) and additions of the point at infinity
+    std::vector<affine_value_type> others;
+    for (std::size_t i = 0; i < size; ++i) {
+        switch (i % 4) {
+            case 0:
+                others.emplace_back(affine_points[(i + 1) % size]);
+                break;
+            case 1:
+                others.emplace_back(affine_points[i]);
+                break;
+            case 2:
+                others.emplace_back(affine_points[i].is_zero() ? affine_value_type::zero() : -affine_points[i]);
+                break;
+            default:
+                others.emplace_back(affine_value_type::zero());
+        }
+    }
+
+    std::vector<affine_value_type> sums(affine_points);
+    batch_affine_add(sums, others);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(from_affine(sums[i]) == points[i] + from_affine(others[i]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 
+BOOST_AUTO_TEST_CASE(batch_affine_operations_test) {
+    check_batch_affine_operations<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3,
+                                                                curves::forms::short_weierstrass>>();
+    check_batch_affine_operations<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3,
+                                                                curves::forms::short_weierstrass>>();
+    check_batch_affine_operations<curves::bls12<381>::g1_type<curves::coordinates::jacobian_with_a4_0,
+                                                              curves::forms::short_weierstrass>>();
+    check_batch_affine_operations<curves::mnt4<298>::g1_type<curves::coordinates::projective,
+                                                             curves::forms::short_weierstrass>>();
+}
+
 BOOST_DATA_TEST_CASE(curve_operation_test_jacobian_minus_3, string_data("curve_operation_test_jacobian_minus_3"), data_set) {
     using policy_type = curves::secp_r1<256>::g1_type< curves::coordinates::jacobian_with_a4_minus_3,  curves::forms::short_weierstrass>;
 
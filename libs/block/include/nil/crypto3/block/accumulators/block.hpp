@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_ACCUMULATORS_BLOCK_HPP
 #define CRYPTO3_ACCUMULATORS_BLOCK_HPP
 
+#include <array>
+
 #include <boost/container/static_vector.hpp>
 
 #include <boost/parameter/value_type.hpp>
@@ -73,12 +75,16 @@ namespace nil {
                     typedef ::nil::crypto3::detail::injector<endian_type, endian_type, value_bits, block_values>
                         injector_type;
 
+                    // Whole blocks are handed to the mode this many at a time, so that ciphers with an
+                    // interleaved encrypt_blocks (AES-NI) get to use it
+                    constexpr static const std::size_t batch_blocks = 8;
+
                 public:
                     typedef digest<block_bits> result_type;
 
                     template<typename Args>
                     block_impl(const Args &args) :
-                        total_seen(0), filled(false), mode(args[boost::accumulators::sample]) {
+                        mode(args[boost::accumulators::sample]), filled(false), total_seen(0), pending(), pending_blocks(0) {
                     }
 
                     template<typename ArgumentPack>
@@ -92,12 +98,14 @@ namespace nil {
 
                         result_type res = dgst;
 
-                        block_type processed_block = mode.end_message(cache, total_seen);
-
-                        res = ::nil::crypto3::resize<block_bits>(res, res.size() + block_values);
+                        if (pending_blocks > 0) {
+                            std::array<block_type, batch_blocks> processed_blocks {};
+                            mode.process_blocks(pending.data(), processed_blocks.data(), pending_blocks);
+                            append_blocks(res, processed_blocks.data(), pending_blocks);
+                        }
 
-                        pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), res.end() - block_values);
+                        block_type processed_block = mode.end_message(cache, total_seen);
+                        append_blocks(res, &processed_block, 1);
 
                         return res;
                     }
@@ -111,20 +119,34 @@ namespace nil {
                         process(value, bits == 0 ? word_bits : bits);
                     }
 
-                    inline void process_block() {
+                    static void append_blocks(result_type &res, const block_type *blocks, std::size_t n) {
                         using namespace ::nil::crypto3::detail;
 
-                        block_type processed_block;
-                        if (dgst.empty()) {
-                            processed_block = mode.begin_message(cache, total_seen);
-                        } else {
-                            processed_block = mode.process_block(cache, total_seen);
+                        res.resize(res.size() + n * block_values);
+
+                        for (std::size_t i = 0; i < n; i++) {
+                            pack<endian_type, endian_type, value_bits, octet_bits>(
+                                blocks[i].begin(), blocks[i].end(), res.end() - (n - i) * block_values);
                         }
+                    }
 
-                        dgst = ::nil::crypto3::resize<block_bits>(dgst, dgst.size() + block_values);
+                    inline void process_pending() {
+                        std::array<block_type, batch_blocks> processed_blocks {};
+                        mode.process_blocks(pending.data(), processed_blocks.data(), pending_blocks);
+                        append_blocks(dgst, processed_blocks.data(), pending_blocks);
+                        pending_blocks = 0;
+                    }
 
-                        pack<endian_type, endian_type, value_bits, octet_bits>(
-                            processed_block.begin(), processed_block.end(), dgst.end() - block_values);
+                    inline void process_block() {
+                        if (dgst.empty() && pending_blocks == 0) {
+                            block_type processed_block = mode.begin_message(cache, total_seen);
+                            append_blocks(dgst, &processed_block, 1);
+                        } else {
+                            pending[pending_blocks++] = cache;
+                            if (pending_blocks == batch_blocks) {
+                                process_pending();
+                            }
+                        }
 
                         filled = false;
                     }
@@ -237,6 +259,8 @@ namespace nil {
                     bool filled;
                     std::size_t total_seen;
                     block_type cache;
+                    std::array<block_type, batch_blocks> pending;
+                    std::size_t pending_blocks;
                     result_type dgst;
                 };
             }    // namespace impl
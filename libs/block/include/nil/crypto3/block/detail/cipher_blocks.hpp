@@ -0,0 +1,87 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_BLOCK_CIPHER_BLOCKS_HPP
+#define CRYPTO3_BLOCK_CIPHER_BLOCKS_HPP
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                template<typename Cipher>
+                inline auto encrypt_blocks_impl(const Cipher &cipher, const typename Cipher::block_type *plaintext,
+                                                typename Cipher::block_type *ciphertext, std::size_t n, int)
+                    -> decltype(cipher.encrypt_blocks(plaintext, ciphertext, n), void()) {
+                    cipher.encrypt_blocks(plaintext, ciphertext, n);
+                }
+
+                template<typename Cipher>
+                inline void encrypt_blocks_impl(const Cipher &cipher, const typename Cipher::block_type *plaintext,
+                                                typename Cipher::block_type *ciphertext, std::size_t n, long) {
+                    for (std::size_t i = 0; i < n; i++) {
+                        ciphertext[i] = cipher.encrypt(plaintext[i]);
+                    }
+                }
+
+                template<typename Cipher>
+                inline auto decrypt_blocks_impl(const Cipher &cipher, const typename Cipher::block_type *ciphertext,
+                                                typename Cipher::block_type *plaintext, std::size_t n, int)
+                    -> decltype(cipher.decrypt_blocks(ciphertext, plaintext, n), void()) {
+                    cipher.decrypt_blocks(ciphertext, plaintext, n);
+                }
+
+                template<typename Cipher>
+                inline void decrypt_blocks_impl(const Cipher &cipher, const typename Cipher::block_type *ciphertext,
+                                                typename Cipher::block_type *plaintext, std::size_t n, long) {
+                    for (std::size_t i = 0; i < n; i++) {
+                        plaintext[i] = cipher.decrypt(ciphertext[i]);
+                    }
+                }
+
+                /*!
+                 * @brief Encrypts n independent blocks with the cipher's encrypt_blocks when it provides one
+                 * (interleaved implementations), block by block otherwise.
+                 */
+                template<typename Cipher>
+                inline void encrypt_blocks(const Cipher &cipher, const typename Cipher::block_type *plaintext,
+                                           typename Cipher::block_type *ciphertext, std::size_t n) {
+                    encrypt_blocks_impl(cipher, plaintext, ciphertext, n, 0);
+                }
+
+                /*!
+                 * @brief Decrypts n independent blocks, see encrypt_blocks.
+                 */
+                template<typename Cipher>
+                inline void decrypt_blocks(const Cipher &cipher, const typename Cipher::block_type *ciphertext,
+                                           typename Cipher::block_type *plaintext, std::size_t n) {
+                    decrypt_blocks_impl(cipher, ciphertext, plaintext, n, 0);
+                }
+            }    // namespace detail
+        }        // namespace block
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_CIPHER_BLOCKS_HPP
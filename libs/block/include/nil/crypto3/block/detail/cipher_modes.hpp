@@ -26,8 +26,12 @@
 #ifndef CRYPTO3_CIPHER_MODES_HPP
 #define CRYPTO3_CIPHER_MODES_HPP
 
+#include <cstddef>
+
 #include <nil/crypto3/detail/stream_endian.hpp>
 
+#include <nil/crypto3/block/detail/cipher_blocks.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace block {
@@ -63,6 +67,11 @@ namespace nil {
                     inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
                         return cipher.encrypt(plaintext);
                     }
+
+                    inline static void process_blocks(const cipher_type &cipher, const block_type *plaintext,
+                                                      block_type *ciphertext, std::size_t n) {
+                        encrypt_blocks(cipher, plaintext, ciphertext, n);
+                    }
                 };
 
                 template<typename Cipher, typename Padding>
@@ -81,6 +90,11 @@ namespace nil {
                     inline static block_type end_message(const cipher_type &cipher, const block_type &ciphertext) {
                         return cipher.decrypt(ciphertext);
                     }
+
+                    inline static void process_blocks(const cipher_type &cipher, const block_type *ciphertext,
+                                                      block_type *plaintext, std::size_t n) {
+                        decrypt_blocks(cipher, ciphertext, plaintext, n);
+                    }
                 };
 
                 template<typename PolicyType>
@@ -119,6 +133,11 @@ namespace nil {
                         return policy_type::end_message(cipher, plaintext);
                     }
 
+                    /// Processes n whole blocks of the message body at once, blocks are independent in this mode
+                    void process_blocks(const block_type *input, block_type *output, std::size_t n) const {
+                        policy_type::process_blocks(cipher, input, output, n);
+                    }
+
                 protected:
                     cipher_type cipher;
                 };
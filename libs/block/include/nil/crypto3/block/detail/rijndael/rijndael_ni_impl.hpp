@@ -26,6 +26,7 @@
 #define CRYPTO3_RIJNDAEL_NI_IMPL_HPP
 
 #include <cstddef>
+#include <cstdint>
 
 #include <wmmintrin.h>
 
@@ -90,6 +91,90 @@ namespace nil {
                     return _mm_xor_si128(key, key_with_rcon);
                 }
 
+                template<bool Decrypt>
+                struct aes_ni_round {
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static __m128i round(__m128i block, __m128i key) {
+                        return _mm_aesenc_si128(block, key);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static __m128i last_round(__m128i block, __m128i key) {
+                        return _mm_aesenclast_si128(block, key);
+                    }
+                };
+
+                template<>
+                struct aes_ni_round<true> {
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static __m128i round(__m128i block, __m128i key) {
+                        return _mm_aesdec_si128(block, key);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static __m128i last_round(__m128i block, __m128i key) {
+                        return _mm_aesdeclast_si128(block, key);
+                    }
+                };
+
+                /*
+                 * Runs eight independent blocks per iteration, so that the aesenc/aesdec latency of one block
+                 * is hidden behind the others. Decryption expects the equivalent inverse key schedule.
+                 */
+                template<std::size_t Rounds, bool Decrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline void aes_ni_process_blocks(const __m128i *key_mm, const std::uint8_t *in, std::uint8_t *out,
+                                                  std::size_t blocks) {
+                    typedef aes_ni_round<Decrypt> round_type;
+
+                    __m128i K[Rounds + 1];
+                    for (std::size_t i = 0; i <= Rounds; i++) {
+                        K[i] = _mm_loadu_si128(key_mm + i);
+                    }
+
+                    const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+                    __m128i *out_mm = reinterpret_cast<__m128i *>(out);
+
+                    for (; blocks >= 8; blocks -= 8, in_mm += 8, out_mm += 8) {
+                        __m128i B0 = _mm_xor_si128(_mm_loadu_si128(in_mm), K[0]);
+                        __m128i B1 = _mm_xor_si128(_mm_loadu_si128(in_mm + 1), K[0]);
+                        __m128i B2 = _mm_xor_si128(_mm_loadu_si128(in_mm + 2), K[0]);
+                        __m128i B3 = _mm_xor_si128(_mm_loadu_si128(in_mm + 3), K[0]);
+                        __m128i B4 = _mm_xor_si128(_mm_loadu_si128(in_mm + 4), K[0]);
+                        __m128i B5 = _mm_xor_si128(_mm_loadu_si128(in_mm + 5), K[0]);
+                        __m128i B6 = _mm_xor_si128(_mm_loadu_si128(in_mm + 6), K[0]);
+                        __m128i B7 = _mm_xor_si128(_mm_loadu_si128(in_mm + 7), K[0]);
+
+                        for (std::size_t r = 1; r < Rounds; r++) {
+                            B0 = round_type::round(B0, K[r]);
+                            B1 = round_type::round(B1, K[r]);
+                            B2 = round_type::round(B2, K[r]);
+                            B3 = round_type::round(B3, K[r]);
+                            B4 = round_type::round(B4, K[r]);
+                            B5 = round_type::round(B5, K[r]);
+                            B6 = round_type::round(B6, K[r]);
+                            B7 = round_type::round(B7, K[r]);
+                        }
+
+                        _mm_storeu_si128(out_mm, round_type::last_round(B0, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 1, round_type::last_round(B1, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 2, round_type::last_round(B2, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 3, round_type::last_round(B3, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 4, round_type::last_round(B4, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 5, round_type::last_round(B5, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 6, round_type::last_round(B6, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 7, round_type::last_round(B7, K[Rounds]));
+                    }
+
+                    for (; blocks > 0; blocks--, in_mm++, out_mm++) {
+                        __m128i B = _mm_xor_si128(_mm_loadu_si128(in_mm), K[0]);
+                        for (std::size_t r = 1; r < Rounds; r++) {
+                            B = round_type::round(B, K[r]);
+                        }
+                        _mm_storeu_si128(out_mm, round_type::last_round(B, K[Rounds]));
+                    }
+                }
+
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
                 class rijndael_ni_impl {
                     typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
@@ -148,6 +233,22 @@ namespace nil {
                         return out;
                     }
 
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void encrypt_blocks(const block_type *plaintext, block_type *ciphertext, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()), plaintext->data(),
+                            ciphertext->data(), n);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void decrypt_blocks(const block_type *ciphertext, block_type *plaintext, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(decryption_key.data()), ciphertext->data(),
+                            plaintext->data(), n);
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -295,6 +396,22 @@ namespace nil {
                         return out;
                     }
 
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void encrypt_blocks(const block_type *plaintext, block_type *ciphertext, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()), plaintext->data(),
+                            ciphertext->data(), n);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void decrypt_blocks(const block_type *ciphertext, block_type *plaintext, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(decryption_key.data()), ciphertext->data(),
+                            plaintext->data(), n);
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -473,6 +590,22 @@ namespace nil {
                         return out;
                     }
 
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void encrypt_blocks(const block_type *plaintext, block_type *ciphertext, std::size_t n,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, false>(
+                            reinterpret_cast<const __m128i *>(encryption_key.data()), plaintext->data(),
+                            ciphertext->data(), n);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                    static void decrypt_blocks(const block_type *ciphertext, block_type *plaintext, std::size_t n,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_process_blocks<policy_type::rounds, true>(
+                            reinterpret_cast<const __m128i *>(decryption_key.data()), ciphertext->data(),
+                            plaintext->data(), n);
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
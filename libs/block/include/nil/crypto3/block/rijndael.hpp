@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_BLOCK_RIJNDAEL_HPP
 #define CRYPTO3_BLOCK_RIJNDAEL_HPP
 
+#include <utility>
+
 #include <boost/range/adaptor/sliced.hpp>
 
 #include <nil/crypto3/block/detail/block_stream_processor.hpp>
@@ -183,7 +185,56 @@ namespace nil {
                     return impl_type::decrypt_block(ciphertext, decryption_key);
                 }
 
+                /*!
+                 * @brief Encrypts n independent blocks. Implementations which can interleave several blocks
+                 * (AES-NI) do so, the others encrypt one block at a time.
+                 */
+                inline void encrypt_blocks(const block_type *plaintext, block_type *ciphertext, std::size_t n) const {
+                    encrypt_blocks_impl<impl_type>(plaintext, ciphertext, n, 0);
+                }
+
+                /*!
+                 * @brief Decrypts n independent blocks, interleaved the same way as encrypt_blocks.
+                 */
+                inline void decrypt_blocks(const block_type *ciphertext, block_type *plaintext, std::size_t n) const {
+                    decrypt_blocks_impl<impl_type>(ciphertext, plaintext, n, 0);
+                }
+
             protected:
+                template<typename Impl>
+                inline auto encrypt_blocks_impl(const block_type *plaintext, block_type *ciphertext, std::size_t n,
+                                                int) const
+                    -> decltype(Impl::encrypt_blocks(plaintext, ciphertext, n,
+                                                     std::declval<const key_schedule_type &>()),
+                                void()) {
+                    Impl::encrypt_blocks(plaintext, ciphertext, n, encryption_key);
+                }
+
+                template<typename Impl>
+                inline void encrypt_blocks_impl(const block_type *plaintext, block_type *ciphertext, std::size_t n,
+                                                long) const {
+                    for (std::size_t i = 0; i < n; i++) {
+                        ciphertext[i] = Impl::encrypt_block(plaintext[i], encryption_key);
+                    }
+                }
+
+                template<typename Impl>
+                inline auto decrypt_blocks_impl(const block_type *ciphertext, block_type *plaintext, std::size_t n,
+                                                int) const
+                    -> decltype(Impl::decrypt_blocks(ciphertext, plaintext, n,
+                                                     std::declval<const key_schedule_type &>()),
+                                void()) {
+                    Impl::decrypt_blocks(ciphertext, plaintext, n, decryption_key);
+                }
+
+                template<typename Impl>
+                inline void decrypt_blocks_impl(const block_type *ciphertext, block_type *plaintext, std::size_t n,
+                                                long) const {
+                    for (std::size_t i = 0; i < n; i++) {
+                        plaintext[i] = Impl::decrypt_block(ciphertext[i], decryption_key);
+                    }
+                }
+
                 key_schedule_type encryption_key, decryption_key;
             };
         } // namespace block
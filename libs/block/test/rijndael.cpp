@@ -385,6 +385,58 @@ BOOST_AUTO_TEST_CASE(aes_256_cipher) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(aes_multi_block_test_suite)
+
+template<typename Cipher>
+void check_multi_block() {
+    typename Cipher::key_type key;
+    for (std::size_t i = 0; i < key.size(); i++) {
+        key[i] = static_cast<typename Cipher::key_type::value_type>(3 * i + 1);
+    }
+    Cipher cipher(key);
+
+    // Not a multiple of the interleave width, so that the single-block tail is exercised as well
+    const std::size_t n = 19;
+    std::vector<typename Cipher::block_type> plaintext(n), ciphertext(n), decrypted(n);
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = 0; j < plaintext[i].size(); j++) {
+            plaintext[i][j] = static_cast<typename Cipher::block_type::value_type>(i * 17 + j);
+        }
+    }
+
+    cipher.encrypt_blocks(plaintext.data(), ciphertext.data(), n);
+    cipher.decrypt_blocks(ciphertext.data(), decrypted.data(), n);
+    for (std::size_t i = 0; i < n; i++) {
+        BOOST_CHECK(ciphertext[i] == cipher.encrypt(plaintext[i]));
+        BOOST_CHECK(decrypted[i] == plaintext[i]);
+    }
+
+    // ECB through the block accumulator batches whole blocks through encrypt_blocks
+    std::vector<std::uint8_t> input, expected;
+    for (std::size_t i = 0; i < n; i++) {
+        input.insert(input.end(), plaintext[i].begin(), plaintext[i].end());
+        expected.insert(expected.end(), ciphertext[i].begin(), ciphertext[i].end());
+    }
+    std::vector<std::uint8_t> output = encrypt<Cipher>(input, key);
+    BOOST_CHECK(output == expected);
+    std::vector<std::uint8_t> roundtrip = decrypt<Cipher>(output, key);
+    BOOST_CHECK(roundtrip == input);
+}
+
+BOOST_AUTO_TEST_CASE(aes_128_multi_block) {
+    check_multi_block<block::aes<128>>();
+}
+
+BOOST_AUTO_TEST_CASE(aes_192_multi_block) {
+    check_multi_block<block::aes<192>>();
+}
+
+BOOST_AUTO_TEST_CASE(aes_256_multi_block) {
+    check_multi_block<block::aes<256>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(rijndael_initializer_list_test_suite)
 
 BOOST_AUTO_TEST_CASE(rijndael_128_128_1) {
@@ -27,8 +27,18 @@
 #ifndef CRYPTO3_MERKLE_TREE_HPP
 #define CRYPTO3_MERKLE_TREE_HPP
 
+#include <cstdint>
 #include <vector>
 #include <cmath>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/range/iterator_range.hpp>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
 
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
@@ -37,6 +47,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 namespace nil {
@@ -478,26 +489,132 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
-                template<typename T, std::size_t Arity, typename LeafIterator>
-                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
-                    typedef T node_type;
-                    typedef typename node_type::hash_type hash_type;
+                // Rows are hashed in chunks of this many nodes, one chunk per OpenMP task. Rows shorter
+                // than a chunk (the top of the tree) are hashed by the calling thread only.
+                constexpr static const std::size_t merkle_tree_chunk_size = 1 << 10;
 
-                    merkle_tree_impl<T, Arity> ret(std::distance(first, last));
-                    ret.reserve(ret.complete_size());
+                // Hashes contiguous runs of leaves and of interior nodes one by one.
+                template<typename HashType, std::size_t Arity>
+                struct merkle_tree_scalar_row_hasher {
+                    typedef HashType hash_type;
 
-                    while (first != last) {
-                        ret.emplace_back(crypto3::hash<hash_type>(*first++));
+                    // out[i] = hash(leaves[i]) for i in [0, count)
+                    template<typename LeafIterator, typename OutputIterator>
+                    static void hash_leaves(LeafIterator leaves, std::size_t count, OutputIterator out) {
+                        typedef typename std::iterator_traits<OutputIterator>::value_type value_type;
+
+                        for (std::size_t i = 0; i < count; ++i, ++leaves, ++out) {
+                            *out = value_type(crypto3::hash<hash_type>(*leaves));
+                        }
                     }
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                    // out[i] = hash(children[i * Arity], ..., children[i * Arity + Arity - 1]) for i in [0, count)
+                    template<typename InputIterator, typename OutputIterator>
+                    static void hash_nodes(InputIterator children, std::size_t count, OutputIterator out) {
+                        for (std::size_t i = 0; i < count; ++i, children += Arity, ++out) {
+                            *out = generate_hash<hash_type>(children, children + Arity);
+                        }
+                    }
+                };
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (size_t i = 0; i < row_size; ++i, it += Arity) {
-                            ret.emplace_back(generate_hash<hash_type>(it, it + Arity));
+                // Hash types with multi-lane kernels specialize it to hash several independent nodes at
+                // once; the digests must match the ones of merkle_tree_scalar_row_hasher.
+                template<typename HashType, std::size_t Arity, typename = void>
+                struct merkle_tree_row_hasher : merkle_tree_scalar_row_hasher<HashType, Arity> { };
+
+                // Leaves stored as octet ranges and digest nodes go through hash_many. The children of
+                // every node are copied next to each other first, so that each node is one message.
+                template<typename HashType, std::size_t Arity>
+                struct merkle_tree_row_hasher<
+                    HashType, Arity,
+                    typename std::enable_if<hashes::detail::multi_lane_hasher<HashType>::is_multi_lane>::type>
+                    : merkle_tree_scalar_row_hasher<HashType, Arity> {
+                    typedef HashType hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+                    typedef merkle_tree_scalar_row_hasher<HashType, Arity> scalar_hasher;
+
+                    template<typename LeafIterator, typename OutputIterator>
+                    static void hash_leaves(LeafIterator leaves, std::size_t count, OutputIterator out) {
+                        typedef typename std::iterator_traits<LeafIterator>::value_type leaf_type;
+
+                        if constexpr (hashes::detail::is_contiguous_octet_range<leaf_type>::value &&
+                                      std::is_base_of<std::random_access_iterator_tag,
+                                                      typename std::iterator_traits<LeafIterator>::iterator_category>::value &&
+                                      std::is_same<typename std::iterator_traits<OutputIterator>::value_type,
+                                                   digest_type>::value) {
+                            crypto3::hash_many<hash_type>(boost::make_iterator_range(leaves, leaves + count), out);
+                        } else {
+                            scalar_hasher::hash_leaves(leaves, count, out);
                         }
                     }
+
+                    template<typename InputIterator, typename OutputIterator>
+                    static void hash_nodes(InputIterator children, std::size_t count, OutputIterator out) {
+                        if constexpr (std::is_same<typename std::iterator_traits<InputIterator>::value_type,
+                                                   digest_type>::value &&
+                                      std::is_same<typename std::iterator_traits<OutputIterator>::value_type,
+                                                   digest_type>::value) {
+                            const std::size_t node_bytes = Arity * hash_type::digest_bits / 8;
+
+                            std::vector<std::uint8_t> buffer(count * node_bytes);
+                            std::vector<const std::uint8_t *> messages(count);
+                            for (std::size_t i = 0; i < count; ++i) {
+                                std::uint8_t *node = buffer.data() + i * node_bytes;
+                                for (std::size_t j = 0; j < Arity; ++j, ++children) {
+                                    node = std::copy(children->begin(), children->end(), node);
+                                }
+                                messages[i] = buffer.data() + i * node_bytes;
+                            }
+                            hashes::detail::hash_many_equal_length<hash_type>(messages.data(), node_bytes, count, out);
+                        } else {
+                            scalar_hasher::hash_nodes(children, count, out);
+                        }
+                    }
+                };
+
+                // Runs body(begin, count) over [0, size) split into merkle_tree_chunk_size pieces
+                template<typename Body>
+                void merkle_tree_for_each_chunk(std::size_t size, Body body) {
+                    const std::ptrdiff_t chunks = (size + merkle_tree_chunk_size - 1) / merkle_tree_chunk_size;
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic) if (chunks > 1)
+#endif
+                    for (std::ptrdiff_t chunk = 0; chunk < chunks; ++chunk) {
+                        const std::size_t begin = chunk * merkle_tree_chunk_size;
+                        body(begin, std::min(merkle_tree_chunk_size, size - begin));
+                    }
+                }
+
+                template<typename T, std::size_t Arity, typename LeafIterator>
+                merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
+                    typedef T node_type;
+                    typedef typename node_type::hash_type hash_type;
+                    typedef merkle_tree_row_hasher<hash_type, Arity> row_hasher;
+
+                    merkle_tree_impl<T, Arity> ret(std::distance(first, last));
+                    // Every row is written in place, so the layout is the same as with sequential
+                    // emplace_back: leaves first, then each row above them, root last.
+                    ret.resize(ret.complete_size());
+
+                    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                                  typename std::iterator_traits<LeafIterator>::iterator_category>::value) {
+                        merkle_tree_for_each_chunk(ret.leaves(), [&](std::size_t begin, std::size_t count) {
+                            row_hasher::hash_leaves(first + begin, count, ret.begin() + begin);
+                        });
+                    } else {
+                        row_hasher::hash_leaves(first, ret.leaves(), ret.begin());
+                    }
+
+                    std::size_t row_begin = 0, row_size = ret.leaves();
+                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number) {
+                        const std::size_t parent_begin = row_begin + row_size, parent_size = row_size / Arity;
+                        merkle_tree_for_each_chunk(parent_size, [&](std::size_t begin, std::size_t count) {
+                            row_hasher::hash_nodes(ret.begin() + row_begin + begin * Arity, count,
+                                                   ret.begin() + parent_begin + begin);
+                        });
+                        row_begin = parent_begin;
+                        row_size = parent_size;
+                    }
                     return ret;
                 }
             }    // namespace detail
@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE containers_merkle_tree_bench_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::containers;
+
+typedef std::array<std::uint8_t, 32> leaf_type;
+
+std::vector<leaf_type> generate_leaves(std::size_t leaf_number) {
+    std::mt19937 gen(0x5eed);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<leaf_type> leaves(leaf_number);
+    for (auto &leaf : leaves) {
+        for (auto &byte : leaf) {
+            byte = static_cast<std::uint8_t>(distrib(gen));
+        }
+    }
+    return leaves;
+}
+
+long long get_msec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(timepoint.time_since_epoch()).count();
+}
+
+// The construction loop make_merkle_tree used before rows were split into chunks
+template<typename HashType, std::size_t Arity>
+merkle_tree<HashType, Arity> make_merkle_tree_serial(const std::vector<leaf_type> &leaves) {
+    merkle_tree<HashType, Arity> ret(leaves.size());
+    ret.reserve(ret.complete_size());
+
+    for (const auto &leaf : leaves) {
+        ret.emplace_back(hash<HashType>(leaf));
+    }
+
+    std::size_t row_size = ret.leaves() / Arity;
+    auto it = ret.begin();
+    for (std::size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
+        for (std::size_t i = 0; i < row_size; ++i, it += Arity) {
+            ret.emplace_back(containers::detail::generate_hash<HashType>(it, it + Arity));
+        }
+    }
+    return ret;
+}
+
+template<typename HashType, std::size_t Arity>
+void print_performance_csv(const char *name, std::size_t log_start, std::size_t log_end) {
+    printf("%s, arity %zu\nlog2(leaves)\tserial, ms\tchunked, ms\n", name, Arity);
+    for (std::size_t log_leaves = log_start; log_leaves <= log_end; log_leaves += 2) {
+        std::vector<leaf_type> leaves = generate_leaves(std::size_t(1) << log_leaves);
+
+        long long start_time = get_msec_time();
+        auto serial_tree = make_merkle_tree_serial<HashType, Arity>(leaves);
+        long long serial_time = get_msec_time() - start_time;
+
+        start_time = get_msec_time();
+        auto tree = make_merkle_tree<HashType, Arity>(leaves.begin(), leaves.end());
+        long long chunked_time = get_msec_time() - start_time;
+
+        printf("%zu\t%lld\t%lld\n", log_leaves, serial_time, chunked_time);
+        fflush(stdout);
+
+        BOOST_CHECK(serial_tree.root() == tree.root());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(merkle_tree_construction_bench)
+
+BOOST_AUTO_TEST_CASE(merkle_tree_keccak_bench) {
+    print_performance_csv<hashes::keccak_1600<256>, 2>("keccak_1600<256>", 16, 24);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree_sha2_bench) {
+    print_performance_csv<hashes::sha2<256>, 2>("sha2<256>", 16, 24);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
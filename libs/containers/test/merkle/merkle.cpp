@@ -253,6 +253,28 @@ void testing_hash_template(std::vector<Element> data, std::string result) {
     BOOST_CHECK(result == std::to_string(tree.root()));
 }
 
+template<typename HashType, size_t Arity>
+void testing_chunked_construction_template(std::size_t leaf_number) {
+    using digest_type = typename HashType::digest_type;
+    auto data = generate_random_data<std::uint8_t, 32>(leaf_number);
+    merkle_tree<HashType, Arity> tree = make_merkle_tree<HashType, Arity>(data.begin(), data.end());
+
+    // Row by row reference with the same layout: leaves first, root last
+    std::vector<digest_type> expected;
+    for (const auto &leaf : data) {
+        expected.emplace_back(hash<HashType>(leaf));
+    }
+    for (std::size_t row_begin = 0, row_size = leaf_number; row_size > 1; row_begin += row_size, row_size /= Arity) {
+        for (std::size_t i = 0; i < row_size / Arity; ++i) {
+            auto children = expected.begin() + row_begin + i * Arity;
+            expected.emplace_back(containers::detail::generate_hash<HashType>(children, children + Arity));
+        }
+    }
+
+    BOOST_CHECK_EQUAL(tree.size(), expected.size());
+    BOOST_CHECK(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
 BOOST_AUTO_TEST_SUITE(containers_merkltree_test)
 
 using curve_type = algebra::curves::pallas;
@@ -397,4 +419,11 @@ BOOST_AUTO_TEST_CASE(merkletree_hash_test_2) {
     testing_hash_template<hashes::blake2b<224>, 3>(v, "d9d0ff26d10aaac2882c08eb2b55e78690c949d1a73b1cfc0eb322ee");
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_chunked_construction_test) {
+    // Enough leaves for several merkle_tree_chunk_size chunks per row
+    testing_chunked_construction_template<hashes::sha2<256>, 2>(1 << 12);
+    testing_chunked_construction_template<hashes::keccak_1600<256>, 2>(1 << 12);
+    testing_chunked_construction_template<hashes::sha2<256>, 4>(1 << 12);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_MANY_HPP
+#define CRYPTO3_HASH_MANY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/detail/multi_lane_hasher.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                // The most lanes any multi_lane_hasher uses
+                constexpr static const std::size_t multi_lane_max_lanes = 16;
+
+                template<typename Message, typename = void>
+                struct is_contiguous_octet_range : std::false_type { };
+
+                template<typename Message>
+                struct is_contiguous_octet_range<
+                    Message, std::void_t<decltype(std::data(std::declval<const Message &>())),
+                                         decltype(std::size(std::declval<const Message &>()))>> {
+                    typedef typename std::remove_cv<typename std::remove_pointer<decltype(std::data(
+                        std::declval<const Message &>()))>::type>::type element_type;
+
+                    constexpr static const bool value = std::is_integral<element_type>::value &&
+                                                        !std::is_same<element_type, bool>::value &&
+                                                        sizeof(element_type) == 1;
+                };
+
+                /*!
+                 * @brief Writes hash<Hash> of count messages, each length bytes long, to out.
+                 *
+                 * Hashes with a multi-lane kernel take the messages lanes() at a time, the idle lanes of the
+                 * last batch repeat one of its messages.
+                 */
+                template<typename Hash, typename OutputIterator>
+                OutputIterator hash_many_equal_length(const std::uint8_t *const *messages, std::size_t length,
+                                                      std::size_t count, OutputIterator out) {
+                    typedef typename Hash::digest_type digest_type;
+                    typedef multi_lane_hasher<Hash> lane_hasher;
+
+                    std::size_t i = 0;
+                    if constexpr (lane_hasher::is_multi_lane) {
+                        const std::size_t lanes = lane_hasher::lanes();
+                        BOOST_ASSERT(lanes <= multi_lane_max_lanes);
+
+                        std::array<digest_type, multi_lane_max_lanes> digests;
+                        const std::uint8_t *lane_messages[multi_lane_max_lanes];
+                        std::uint8_t *lane_digests[multi_lane_max_lanes];
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            lane_digests[l] = digests[l].data();
+                        }
+
+                        for (; lanes > 1 && count - i > 1; i += std::min(lanes, count - i)) {
+                            const std::size_t batch = std::min(lanes, count - i);
+                            for (std::size_t l = 0; l < lanes; ++l) {
+                                lane_messages[l] = messages[i + (l < batch ? l : 0)];
+                            }
+                            lane_hasher::hash_lanes(lane_messages, length, lane_digests);
+                            out = std::copy(digests.begin(), digests.begin() + batch, out);
+                        }
+                    }
+
+                    for (; i < count; ++i) {
+                        digest_type digest = crypto3::hash<Hash>(messages[i], messages[i] + length);
+                        *out++ = digest;
+                    }
+                    return out;
+                }
+            }    // namespace detail
+        }        // namespace hashes
+
+        /*!
+         * @brief Hashes every message of the range independently, out[i] = hash<Hash>(messages[i]).
+         *
+         * Keccak, SHA-3 and SHA-256 hash runs of consecutive messages of the same length in parallel
+         * vector lanes when the CPU supports AVX2 or AVX-512 and the messages are contiguous ranges of
+         * octets, such as std::vector<std::uint8_t> or std::array<std::uint8_t, N>. Other hashes and
+         * messages go through hash<Hash> one by one.
+         *
+         * @ingroup hash_algorithms
+         *
+         * @tparam Hash
+         * @tparam InputRange
+         * @tparam OutputIterator
+         *
+         * @param messages
+         * @param out
+         *
+         * @return
+         */
+        template<typename Hash, typename InputRange, typename OutputIterator>
+        OutputIterator hash_many(const InputRange &messages, OutputIterator out) {
+            typedef typename Hash::digest_type digest_type;
+            typedef typename std::iterator_traits<decltype(std::begin(messages))>::value_type message_type;
+
+            if constexpr (hashes::detail::multi_lane_hasher<Hash>::is_multi_lane &&
+                          hashes::detail::is_contiguous_octet_range<message_type>::value) {
+                std::vector<const std::uint8_t *> run;
+                auto it = std::begin(messages);
+                const auto last = std::end(messages);
+                while (it != last) {
+                    const std::size_t length = std::size(*it);
+                    run.clear();
+                    for (; it != last && std::size(*it) == length; ++it) {
+                        run.push_back(reinterpret_cast<const std::uint8_t *>(std::data(*it)));
+                    }
+                    out = hashes::detail::hash_many_equal_length<Hash>(run.data(), length, run.size(), out);
+                }
+            } else {
+                for (const auto &message : messages) {
+                    digest_type digest = hash<Hash>(message);
+                    *out++ = digest;
+                }
+            }
+            return out;
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_MANY_HPP
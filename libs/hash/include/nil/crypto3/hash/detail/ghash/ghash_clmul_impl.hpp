@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_GHASH_CLMUL_IMPL_HPP
+#define CRYPTO3_HASH_GHASH_CLMUL_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#if (BOOST_ARCH_X86_64 || BOOST_ARCH_X86_32) && defined(BOOST_ATTRIBUTE_TARGET) && !defined(__ZKLLVM__)
+#define CRYPTO3_HASH_GHASH_CLMUL
+#endif
+
+#ifdef CRYPTO3_HASH_GHASH_CLMUL
+
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief GHASH with PCLMULQDQ.
+                 *
+                 * Blocks are processed eight at a time against the precomputed powers H^8 ... H^1: the
+                 * unreduced 256-bit products are summed and reduced once per eight blocks. Field elements are
+                 * kept in byte-reflected registers, whose two 64-bit halves are the high and the low big-endian
+                 * halves of the block, so the accumulator layout matches ghash_impl.
+                 */
+                struct ghash_clmul_impl {
+                    constexpr static const std::size_t aggregated_blocks = 8;
+
+                    /// powers[i] holds H^(i + 1), low 64-bit half first
+                    typedef std::uint64_t powers_type[aggregated_blocks][2];
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i reduce(__m128i lo, __m128i mid, __m128i hi) {
+                        lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+                        hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+                        // Shift the 256-bit product left by one, it is bit-reflected
+                        __m128i lo_carry = _mm_srli_epi32(lo, 31);
+                        __m128i hi_carry = _mm_srli_epi32(hi, 31);
+                        lo = _mm_slli_epi32(lo, 1);
+                        hi = _mm_slli_epi32(hi, 1);
+
+                        const __m128i cross_carry = _mm_srli_si128(lo_carry, 12);
+                        hi_carry = _mm_slli_si128(hi_carry, 4);
+                        lo_carry = _mm_slli_si128(lo_carry, 4);
+                        lo = _mm_or_si128(lo, lo_carry);
+                        hi = _mm_or_si128(hi, hi_carry);
+                        hi = _mm_or_si128(hi, cross_carry);
+
+                        // Reduce modulo x^128 + x^7 + x^2 + x + 1
+                        __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+                                                  _mm_slli_epi32(lo, 25));
+                        const __m128i t_high = _mm_srli_si128(t, 4);
+                        t = _mm_slli_si128(t, 12);
+                        lo = _mm_xor_si128(lo, t);
+
+                        __m128i u = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+                                                  _mm_srli_epi32(lo, 7));
+                        u = _mm_xor_si128(u, t_high);
+                        lo = _mm_xor_si128(lo, u);
+                        return _mm_xor_si128(hi, lo);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline void accumulate(__m128i a, __m128i b, __m128i &lo, __m128i &mid, __m128i &hi) {
+                        lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(a, b, 0x00));
+                        mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x10));
+                        mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x01));
+                        hi = _mm_xor_si128(hi, _mm_clmulepi64_si128(a, b, 0x11));
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i multiply(__m128i a, __m128i b) {
+                        __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                        accumulate(a, b, lo, mid, hi);
+                        return reduce(lo, mid, hi);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static inline __m128i load_block(const std::uint8_t *data) {
+                        const __m128i byte_reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)),
+                                                byte_reverse);
+                    }
+
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void schedule_key(const std::uint64_t h[2], powers_type powers) {
+                        const __m128i H = _mm_set_epi64x(static_cast<long long>(h[0]), static_cast<long long>(h[1]));
+                        __m128i power = H;
+                        for (std::size_t i = 0; i < aggregated_blocks; i++) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(powers[i]), power);
+                            power = multiply(power, H);
+                        }
+                    }
+
+                    /// y = (((y ^ X_1) * H ^ X_2) * H ...) * H over the given full blocks
+                    BOOST_ATTRIBUTE_TARGET("pclmul,ssse3")
+                    static void multiply_blocks(std::uint64_t y[2], const powers_type powers, const std::uint8_t *data,
+                                                std::size_t blocks) {
+                        __m128i H[aggregated_blocks];
+                        for (std::size_t i = 0; i < aggregated_blocks; i++) {
+                            H[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(powers[i]));
+                        }
+
+                        __m128i Y = _mm_set_epi64x(static_cast<long long>(y[0]), static_cast<long long>(y[1]));
+
+                        for (; blocks >= aggregated_blocks; blocks -= aggregated_blocks, data += 16 * aggregated_blocks) {
+                            __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+
+                            accumulate(_mm_xor_si128(Y, load_block(data)), H[7], lo, mid, hi);
+                            accumulate(load_block(data + 16), H[6], lo, mid, hi);
+                            accumulate(load_block(data + 32), H[5], lo, mid, hi);
+                            accumulate(load_block(data + 48), H[4], lo, mid, hi);
+                            accumulate(load_block(data + 64), H[3], lo, mid, hi);
+                            accumulate(load_block(data + 80), H[2], lo, mid, hi);
+                            accumulate(load_block(data + 96), H[1], lo, mid, hi);
+                            accumulate(load_block(data + 112), H[0], lo, mid, hi);
+
+                            Y = reduce(lo, mid, hi);
+                        }
+
+                        for (; blocks > 0; blocks--, data += 16) {
+                            Y = multiply(_mm_xor_si128(Y, load_block(data)), H[0]);
+                        }
+
+                        alignas(16) std::uint64_t result[2];
+                        _mm_store_si128(reinterpret_cast<__m128i *>(result), Y);
+                        y[0] = result[1];
+                        y[1] = result[0];
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_GHASH_CLMUL
+
+#endif    // CRYPTO3_HASH_GHASH_CLMUL_IMPL_HPP
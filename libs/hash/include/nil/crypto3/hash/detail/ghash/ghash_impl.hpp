@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_GHASH_IMPL_HPP
+#define CRYPTO3_HASH_GHASH_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Portable GHASH multiplication.
+                 *
+                 * Constant-time: carryless 64x64 products are computed with integer multiplications on
+                 * operands masked to every fourth bit, so that carries can't spill into the bits of interest.
+                 * The accumulator and the key are kept as two big-endian 64-bit halves, high half first.
+                 */
+                struct ghash_impl {
+                    static inline std::uint64_t load_be64(const std::uint8_t *p) {
+                        std::uint64_t x = 0;
+                        for (std::size_t i = 0; i < 8; i++) {
+                            x = (x << 8) | p[i];
+                        }
+                        return x;
+                    }
+
+                    static inline void store_be64(std::uint8_t *p, std::uint64_t x) {
+                        for (std::size_t i = 8; i-- > 0;) {
+                            p[i] = static_cast<std::uint8_t>(x);
+                            x >>= 8;
+                        }
+                    }
+
+                    static inline std::uint64_t bmul64(std::uint64_t x, std::uint64_t y) {
+                        const std::uint64_t m0 = 0x1111111111111111, m1 = 0x2222222222222222,
+                                            m2 = 0x4444444444444444, m3 = 0x8888888888888888;
+
+                        const std::uint64_t x0 = x & m0, x1 = x & m1, x2 = x & m2, x3 = x & m3;
+                        const std::uint64_t y0 = y & m0, y1 = y & m1, y2 = y & m2, y3 = y & m3;
+
+                        const std::uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+                        const std::uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+                        const std::uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+                        const std::uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+
+                        return (z0 & m0) | (z1 & m1) | (z2 & m2) | (z3 & m3);
+                    }
+
+                    static inline std::uint64_t rev64(std::uint64_t x) {
+                        x = ((x & 0x5555555555555555) << 1) | ((x >> 1) & 0x5555555555555555);
+                        x = ((x & 0x3333333333333333) << 2) | ((x >> 2) & 0x3333333333333333);
+                        x = ((x & 0x0F0F0F0F0F0F0F0F) << 4) | ((x >> 4) & 0x0F0F0F0F0F0F0F0F);
+                        x = ((x & 0x00FF00FF00FF00FF) << 8) | ((x >> 8) & 0x00FF00FF00FF00FF);
+                        x = ((x & 0x0000FFFF0000FFFF) << 16) | ((x >> 16) & 0x0000FFFF0000FFFF);
+                        return (x << 32) | (x >> 32);
+                    }
+
+                    /// y = (((y ^ X_1) * H ^ X_2) * H ...) * H over the given full blocks
+                    static void multiply_blocks(std::uint64_t y[2], const std::uint64_t h[2], const std::uint8_t *data,
+                                                std::size_t blocks) {
+                        const std::uint64_t h1 = h[0], h0 = h[1];
+                        const std::uint64_t h0r = rev64(h0), h1r = rev64(h1);
+                        const std::uint64_t h2 = h0 ^ h1, h2r = h0r ^ h1r;
+
+                        std::uint64_t y1 = y[0], y0 = y[1];
+                        for (; blocks > 0; blocks--, data += 16) {
+                            y1 ^= load_be64(data);
+                            y0 ^= load_be64(data + 8);
+
+                            const std::uint64_t y0r = rev64(y0), y1r = rev64(y1);
+                            const std::uint64_t y2 = y0 ^ y1, y2r = y0r ^ y1r;
+
+                            const std::uint64_t z0 = bmul64(y0, h0);
+                            const std::uint64_t z1 = bmul64(y1, h1);
+                            std::uint64_t z2 = bmul64(y2, h2);
+                            std::uint64_t z0h = bmul64(y0r, h0r);
+                            std::uint64_t z1h = bmul64(y1r, h1r);
+                            std::uint64_t z2h = bmul64(y2r, h2r);
+
+                            z2 ^= z0 ^ z1;
+                            z2h ^= z0h ^ z1h;
+                            z0h = rev64(z0h) >> 1;
+                            z1h = rev64(z1h) >> 1;
+                            z2h = rev64(z2h) >> 1;
+
+                            std::uint64_t v0 = z0, v1 = z0h ^ z2, v2 = z1 ^ z2h, v3 = z1h;
+
+                            // The product is bit-reflected, shift it by one and reduce modulo x^128 + x^7 + x^2 + x + 1
+                            v3 = (v3 << 1) | (v2 >> 63);
+                            v2 = (v2 << 1) | (v1 >> 63);
+                            v1 = (v1 << 1) | (v0 >> 63);
+                            v0 = (v0 << 1);
+
+                            v2 ^= v0 ^ (v0 >> 1) ^ (v0 >> 2) ^ (v0 >> 7);
+                            v1 ^= (v0 << 63) ^ (v0 << 62) ^ (v0 << 57);
+                            v3 ^= v1 ^ (v1 >> 1) ^ (v1 >> 2) ^ (v1 >> 7);
+                            v2 ^= (v1 << 63) ^ (v1 << 62) ^ (v1 << 57);
+
+                            y0 = v2;
+                            y1 = v3;
+                        }
+                        y[0] = y1;
+                        y[1] = y0;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_GHASH_IMPL_HPP
@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
+#define CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/config.hpp>
+#include <boost/endian/conversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Keccak sponge over Lanes independent messages of the same length at once.
+                 *
+                 * VectorType holds the same state word of every message, one per lane. It has to support
+                 * the builtin integer operators and subscripting, as GCC and Clang vector extensions do.
+                 * Instantiate it from a function compiled for the matching instruction set.
+                 */
+                template<typename VectorType, std::size_t Lanes>
+                struct keccak_1600_multi_lane_impl {
+                    typedef VectorType vector_type;
+                    typedef std::array<vector_type, 25> state_type;
+
+                    constexpr static const std::size_t lanes = Lanes;
+                    constexpr static const std::size_t rounds = 24;
+
+                    constexpr static const std::array<std::uint64_t, rounds> round_constants = {
+                        UINT64_C(0x0000000000000001), UINT64_C(0x0000000000008082), UINT64_C(0x800000000000808a),
+                        UINT64_C(0x8000000080008000), UINT64_C(0x000000000000808b), UINT64_C(0x0000000080000001),
+                        UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008009), UINT64_C(0x000000000000008a),
+                        UINT64_C(0x0000000000000088), UINT64_C(0x0000000080008009), UINT64_C(0x000000008000000a),
+                        UINT64_C(0x000000008000808b), UINT64_C(0x800000000000008b), UINT64_C(0x8000000000008089),
+                        UINT64_C(0x8000000000008003), UINT64_C(0x8000000000008002), UINT64_C(0x8000000000000080),
+                        UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a), UINT64_C(0x8000000080008081),
+                        UINT64_C(0x8000000000008080), UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)};
+
+                    // Rho offsets along the pi walk that starts at word 1
+                    constexpr static const std::array<int, 24> rotations = {1,  3,  6,  10, 15, 21, 28, 36,
+                                                                            45, 55, 2,  14, 27, 41, 56, 8,
+                                                                            25, 43, 62, 18, 39, 61, 20, 44};
+                    constexpr static const std::array<std::size_t, 24> pi_lanes = {10, 7,  11, 17, 18, 3,  5,  16,
+                                                                                   8,  21, 24, 4,  15, 23, 19, 13,
+                                                                                   12, 2,  20, 14, 22, 9,  6,  1};
+
+                    BOOST_FORCEINLINE static void permute(state_type &A) {
+                        vector_type C[5];
+                        for (std::size_t round = 0; round < rounds; ++round) {
+                            // theta
+                            for (std::size_t x = 0; x < 5; ++x) {
+                                C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+                            }
+                            for (std::size_t x = 0; x < 5; ++x) {
+                                const vector_type &c = C[(x + 1) % 5];
+                                const vector_type D = C[(x + 4) % 5] ^ (c << 1) ^ (c >> 63);
+                                for (std::size_t y = 0; y < 25; y += 5) {
+                                    A[y + x] ^= D;
+                                }
+                            }
+
+                            // rho and pi
+                            vector_type current = A[1];
+                            for (std::size_t i = 0; i < 24; ++i) {
+                                const vector_type next = A[pi_lanes[i]];
+                                A[pi_lanes[i]] = (current << rotations[i]) | (current >> (64 - rotations[i]));
+                                current = next;
+                            }
+
+                            // chi
+                            for (std::size_t y = 0; y < 25; y += 5) {
+                                for (std::size_t x = 0; x < 5; ++x) {
+                                    C[x] = A[y + x];
+                                }
+                                for (std::size_t x = 0; x < 5; ++x) {
+                                    A[y + x] ^= ~C[(x + 1) % 5] & C[(x + 2) % 5];
+                                }
+                            }
+
+                            // iota
+                            A[0] ^= round_constants[round];
+                        }
+                    }
+
+                    BOOST_FORCEINLINE static void absorb(state_type &A, const std::uint8_t *const *blocks,
+                                                         std::size_t offset, std::size_t rate_bytes) {
+                        for (std::size_t w = 0; w < rate_bytes / 8; ++w) {
+                            vector_type v;
+                            for (std::size_t l = 0; l < lanes; ++l) {
+                                std::uint64_t word;
+                                std::memcpy(&word, blocks[l] + offset + 8 * w, 8);
+                                v[l] = boost::endian::little_to_native(word);
+                            }
+                            A[w] ^= v;
+                        }
+                        permute(A);
+                    }
+
+                    /*!
+                     * @brief digests[l] = first digest_bytes of the sponge over messages[l], padded with
+                     * domain_byte and the final bit as in pad10*1. Every message is length bytes long.
+                     */
+                    BOOST_FORCEINLINE static void hash(const std::uint8_t *const *messages, std::size_t length,
+                                                       std::size_t rate_bytes, std::uint8_t domain_byte,
+                                                       std::uint8_t *const *digests, std::size_t digest_bytes) {
+                        state_type A;
+                        for (auto &word : A) {
+                            word = vector_type {};
+                        }
+
+                        const std::size_t full_blocks_bytes = length - length % rate_bytes;
+                        for (std::size_t offset = 0; offset < full_blocks_bytes; offset += rate_bytes) {
+                            absorb(A, messages, offset, rate_bytes);
+                        }
+
+                        // The rate is at most 168 bytes
+                        std::uint8_t tails[lanes][168] = {};
+                        const std::uint8_t *tail_pointers[lanes];
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            if (length > full_blocks_bytes) {
+                                std::memcpy(tails[l], messages[l] + full_blocks_bytes, length - full_blocks_bytes);
+                            }
+                            tails[l][length - full_blocks_bytes] ^= domain_byte;
+                            tails[l][rate_bytes - 1] ^= 0x80;
+                            tail_pointers[l] = tails[l];
+                        }
+                        absorb(A, tail_pointers, 0, rate_bytes);
+
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            for (std::size_t i = 0; i < digest_bytes; i += 8) {
+                                const std::uint64_t word = boost::endian::native_to_little(std::uint64_t(A[i / 8][l]));
+                                std::memcpy(digests[l] + i, &word, std::min<std::size_t>(8, digest_bytes - i));
+                            }
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_KECCAK_MULTI_LANE_IMPL_HPP
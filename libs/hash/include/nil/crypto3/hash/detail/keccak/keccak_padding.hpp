@@ -88,10 +88,20 @@ namespace nil {
                                                   block_seen, padding_start_bits_for_first_block);
                         }
 
-                        // fill the rest of the block with zeros
-                        block_type zeros;
-                        std::fill(zeros.begin(), zeros.end(), 0);
-                        injector_type::inject(zeros, block_bits - 1 - block_seen, new_block, block_seen);
+                        // fill the rest of the block up to the last bit with zeros: the rest of the current word
+                        // bit by bit, then whole words
+                        const std::size_t zeros_end = block_bits - 1;
+                        const std::size_t word_tail_bits =
+                            std::min((word_bits - block_seen % word_bits) % word_bits, zeros_end - block_seen);
+                        if (word_tail_bits > 0) {
+                            injector_type::inject(word_type(), word_tail_bits, new_block, block_seen);
+                        }
+                        for (; block_seen + word_bits <= zeros_end; block_seen += word_bits) {
+                            new_block[block_seen / word_bits] = 0;
+                        }
+                        if (block_seen < zeros_end) {
+                            injector_type::inject(word_type(), zeros_end - block_seen, new_block, block_seen);
+                        }
 
                         // add the last 1
                         injector_type::inject(high_bits<word_bits>(~word_type(), 1), 1, new_block,
@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_MULTI_LANE_HASHER_HPP
+#define CRYPTO3_HASH_MULTI_LANE_HASHER_HPP
+
+#include <cstdint>
+
+#include <boost/assert.hpp>
+#include <boost/predef/architecture.h>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+#include <nil/crypto3/hash/detail/keccak/keccak_multi_lane_impl.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha256_multi_lane_impl.hpp>
+
+#if BOOST_ARCH_X86_64 && defined(BOOST_ATTRIBUTE_TARGET) && !defined(__ZKLLVM__)
+#define CRYPTO3_HASH_MULTI_LANE_X86_64
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                enum class multi_lane_isa { none, avx2, avx512 };
+
+                //! Widest vector instruction set the multi-lane kernels can use on this CPU
+                inline multi_lane_isa supported_multi_lane_isa() {
+#ifdef CRYPTO3_HASH_MULTI_LANE_X86_64
+                    static const multi_lane_isa isa = __builtin_cpu_supports("avx512f") ? multi_lane_isa::avx512 :
+                                                      __builtin_cpu_supports("avx2")    ? multi_lane_isa::avx2 :
+                                                                                          multi_lane_isa::none;
+                    return isa;
+#else
+                    return multi_lane_isa::none;
+#endif
+                }
+
+#ifdef CRYPTO3_HASH_MULTI_LANE_X86_64
+                typedef std::uint64_t multi_lane_u64x4 __attribute__((vector_size(32)));
+                typedef std::uint64_t multi_lane_u64x8 __attribute__((vector_size(64)));
+                typedef std::uint32_t multi_lane_u32x8 __attribute__((vector_size(32)));
+                typedef std::uint32_t multi_lane_u32x16 __attribute__((vector_size(64)));
+
+                BOOST_ATTRIBUTE_TARGET("avx2")
+                inline void keccak_1600_hash_avx2(const std::uint8_t *const *messages, std::size_t length,
+                                                  std::size_t rate_bytes, std::uint8_t domain_byte,
+                                                  std::uint8_t *const *digests, std::size_t digest_bytes) {
+                    keccak_1600_multi_lane_impl<multi_lane_u64x4, 4>::hash(messages, length, rate_bytes, domain_byte,
+                                                                           digests, digest_bytes);
+                }
+
+                BOOST_ATTRIBUTE_TARGET("avx512f")
+                inline void keccak_1600_hash_avx512(const std::uint8_t *const *messages, std::size_t length,
+                                                    std::size_t rate_bytes, std::uint8_t domain_byte,
+                                                    std::uint8_t *const *digests, std::size_t digest_bytes) {
+                    keccak_1600_multi_lane_impl<multi_lane_u64x8, 8>::hash(messages, length, rate_bytes, domain_byte,
+                                                                           digests, digest_bytes);
+                }
+
+                BOOST_ATTRIBUTE_TARGET("avx2")
+                inline void sha256_hash_avx2(const std::uint8_t *const *messages, std::size_t length,
+                                             std::uint8_t *const *digests) {
+                    sha256_multi_lane_impl<multi_lane_u32x8, 8>::hash(messages, length, digests);
+                }
+
+                BOOST_ATTRIBUTE_TARGET("avx512f")
+                inline void sha256_hash_avx512(const std::uint8_t *const *messages, std::size_t length,
+                                               std::uint8_t *const *digests) {
+                    sha256_multi_lane_impl<multi_lane_u32x16, 16>::hash(messages, length, digests);
+                }
+#endif
+
+                /*!
+                 * @brief Hashes several independent messages of the same length at once, one per vector lane.
+                 *
+                 * Specializations provide lanes(), the number of messages hash_lanes takes on this CPU,
+                 * and hash_lanes itself. lanes() is 1 when no suitable instruction set is available, in
+                 * which case the messages have to go through the usual hash path. The digests are the
+                 * ones of hash<Hash>.
+                 */
+                template<typename Hash>
+                struct multi_lane_hasher {
+                    constexpr static const bool is_multi_lane = false;
+                };
+
+                template<std::size_t DigestBits, std::uint8_t DomainByte>
+                struct keccak_1600_multi_lane_hasher {
+                    constexpr static const bool is_multi_lane = true;
+
+                    constexpr static const std::size_t digest_bytes = DigestBits / 8;
+                    constexpr static const std::size_t rate_bytes = 200 - 2 * digest_bytes;
+
+                    static std::size_t lanes() {
+                        switch (supported_multi_lane_isa()) {
+                            case multi_lane_isa::avx512:
+                                return 8;
+                            case multi_lane_isa::avx2:
+                                return 4;
+                            default:
+                                return 1;
+                        }
+                    }
+
+                    static void hash_lanes(const std::uint8_t *const *messages, std::size_t length,
+                                           std::uint8_t *const *digests) {
+#ifdef CRYPTO3_HASH_MULTI_LANE_X86_64
+                        switch (supported_multi_lane_isa()) {
+                            case multi_lane_isa::avx512:
+                                keccak_1600_hash_avx512(messages, length, rate_bytes, DomainByte, digests,
+                                                        digest_bytes);
+                                return;
+                            case multi_lane_isa::avx2:
+                                keccak_1600_hash_avx2(messages, length, rate_bytes, DomainByte, digests, digest_bytes);
+                                return;
+                            default:
+                                break;
+                        }
+#endif
+                        BOOST_ASSERT_MSG(false, "multi-lane hashing is not supported on this CPU");
+                    }
+                };
+
+                template<std::size_t DigestBits>
+                struct multi_lane_hasher<keccak_1600<DigestBits>> : keccak_1600_multi_lane_hasher<DigestBits, 0x01> { };
+
+                template<std::size_t DigestBits>
+                struct multi_lane_hasher<sha3<DigestBits>> : keccak_1600_multi_lane_hasher<DigestBits, 0x06> { };
+
+                template<>
+                struct multi_lane_hasher<sha2<256>> {
+                    constexpr static const bool is_multi_lane = true;
+
+                    static std::size_t lanes() {
+                        switch (supported_multi_lane_isa()) {
+                            case multi_lane_isa::avx512:
+                                return 16;
+                            case multi_lane_isa::avx2:
+                                return 8;
+                            default:
+                                return 1;
+                        }
+                    }
+
+                    static void hash_lanes(const std::uint8_t *const *messages, std::size_t length,
+                                           std::uint8_t *const *digests) {
+#ifdef CRYPTO3_HASH_MULTI_LANE_X86_64
+                        switch (supported_multi_lane_isa()) {
+                            case multi_lane_isa::avx512:
+                                sha256_hash_avx512(messages, length, digests);
+                                return;
+                            case multi_lane_isa::avx2:
+                                sha256_hash_avx2(messages, length, digests);
+                                return;
+                            default:
+                                break;
+                        }
+#endif
+                        BOOST_ASSERT_MSG(false, "multi-lane hashing is not supported on this CPU");
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_MULTI_LANE_HASHER_HPP
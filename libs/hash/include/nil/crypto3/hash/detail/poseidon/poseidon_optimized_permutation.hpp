@@ -0,0 +1,326 @@
+//---------------------------------------------------------------------------//
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_POSEIDON_OPTIMIZED_PERMUTATION_HPP
+#define CRYPTO3_HASH_POSEIDON_OPTIMIZED_PERMUTATION_HPP
+
+#include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_constants.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+
+                /*!
+                 * @brief Original (ARC-SBOX-MDS) Poseidon permutation with the partial rounds computed as described
+                 * in Appendix B of the Poseidon paper.
+                 *
+                 * The round constants of the partial rounds are pushed backwards through the linear layers, so all
+                 * but the first partial round add a single constant to the first word. The MDS matrix of every
+                 * partial round is factored as sparse * (1 (+) M'), and the (1 (+) M') factors are pushed backwards
+                 * into a single dense multiplication before the first partial round, so a partial round costs about
+                 * 2 * state_words multiplications instead of state_words^2. The output is identical to
+                 * poseidon_round_operator based permutation.
+                 *
+                 * The state is treated as a column vector here, so the MDS layer is a product with the transposed
+                 * poseidon_constants::mds_matrix.
+                 */
+                template<typename PolicyType>
+                class poseidon_optimized_permutation {
+                public:
+                    typedef PolicyType policy_type;
+                    typedef poseidon_constants<policy_type> poseidon_constants_type;
+
+                    typedef typename policy_type::word_type element_type;
+
+                    constexpr static const std::size_t state_words = policy_type::state_words;
+                    typedef typename policy_type::state_type state_type;
+
+                    constexpr static const std::size_t full_rounds = policy_type::full_rounds;
+                    constexpr static const std::size_t half_full_rounds = policy_type::half_full_rounds;
+                    constexpr static const std::size_t part_rounds = policy_type::part_rounds;
+                    constexpr static const std::size_t sbox_power = policy_type::sbox_power;
+
+                    /// Number of states processed round by round together in permute_many.
+                    constexpr static const std::size_t batch_size = 8;
+
+                    typedef std::array<element_type, state_words - 1> inner_vector_type;
+                    typedef std::array<inner_vector_type, state_words - 1> inner_matrix_type;
+                    typedef std::array<state_type, state_words> matrix_type;
+
+                    struct constants_type {
+                        /// Transposed MDS matrix, used by the full rounds.
+                        matrix_type mds_matrix;
+                        /// Lower-right block of the dense matrix applied before the first partial round.
+                        inner_matrix_type pre_sparse_matrix;
+                        /// Constants of the first partial round, already multiplied by the dense matrix.
+                        state_type first_part_round_constants;
+                        /// Folded constants of the partial rounds, added to the first word. Entry 0 is unused.
+                        std::array<element_type, part_rounds> part_round_constants;
+                        /// First row (without the diagonal element) of the sparse matrix of each partial round.
+                        std::array<inner_vector_type, part_rounds> sparse_rows;
+                        /// First column (without the diagonal element) of the sparse matrix of each partial round.
+                        std::array<inner_vector_type, part_rounds> sparse_columns;
+                    };
+
+                    /*!
+                     * @brief Returns the precomputed tables. They are derived from poseidon_constants once per policy,
+                     * at the first call.
+                     */
+                    static const constants_type &constants() {
+                        static const constants_type precomputed = generate_constants();
+                        return precomputed;
+                    }
+
+                    static inline void permute(state_type &A) {
+                        permute_batch(&A, 1, constants());
+                    }
+
+                    /*!
+                     * @brief Permutes every state of [first, last) in place. States are processed round by round in
+                     * batches of batch_size, so the independent multiplications of different states interleave.
+                     */
+                    template<typename Iterator>
+                    static void permute_many(Iterator first, Iterator last) {
+                        const constants_type &c = constants();
+
+                        std::size_t count = std::distance(first, last);
+                        while (count > 0) {
+                            const std::size_t n = std::min(count, batch_size);
+                            permute_batch(first, n, c);
+                            std::advance(first, n);
+                            count -= n;
+                        }
+                    }
+
+                private:
+                    template<typename Iterator>
+                    static inline void permute_batch(Iterator states, std::size_t n, const constants_type &c) {
+                        std::size_t round_number = 0;
+
+                        for (std::size_t r = 0; r < half_full_rounds; r++) {
+                            for (std::size_t s = 0; s < n; s++) {
+                                full_round(states[s], round_number, c);
+                            }
+                            round_number++;
+                        }
+
+                        if constexpr (part_rounds > 0) {
+                            for (std::size_t s = 0; s < n; s++) {
+                                state_type &A = states[s];
+                                product_with_pre_sparse_matrix(A, c);
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    A[i] += c.first_part_round_constants[i];
+                                }
+                                A[0] = poseidon_sbox<sbox_power>(A[0]);
+                                product_with_sparse_matrix(A, 0, c);
+                            }
+                            for (std::size_t r = 1; r < part_rounds; r++) {
+                                for (std::size_t s = 0; s < n; s++) {
+                                    state_type &A = states[s];
+                                    A[0] = poseidon_sbox<sbox_power>(A[0] + c.part_round_constants[r]);
+                                    product_with_sparse_matrix(A, r, c);
+                                }
+                            }
+                            round_number += part_rounds;
+                        }
+
+                        for (std::size_t r = half_full_rounds; r < full_rounds; r++) {
+                            for (std::size_t s = 0; s < n; s++) {
+                                full_round(states[s], round_number, c);
+                            }
+                            round_number++;
+                        }
+                    }
+
+                    static inline void full_round(state_type &A, std::size_t round_number, const constants_type &c) {
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            A[i] = poseidon_sbox<sbox_power>(A[i] +
+                                                             poseidon_constants_type::round_constant(round_number, i));
+                        }
+
+                        const state_type B = A;
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            A[i] = c.mds_matrix[i][0] * B[0];
+                            for (std::size_t j = 1; j < state_words; j++) {
+                                A[i] += c.mds_matrix[i][j] * B[j];
+                            }
+                        }
+                    }
+
+                    static inline void product_with_pre_sparse_matrix(state_type &A, const constants_type &c) {
+                        const state_type B = A;
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            A[i] = c.pre_sparse_matrix[i - 1][0] * B[1];
+                            for (std::size_t j = 2; j < state_words; j++) {
+                                A[i] += c.pre_sparse_matrix[i - 1][j - 1] * B[j];
+                            }
+                        }
+                    }
+
+                    static inline void product_with_sparse_matrix(state_type &A, std::size_t r, const constants_type &c) {
+                        const element_type a0 = A[0];
+                        A[0] = c.mds_matrix[0][0] * a0;
+                        for (std::size_t i = 1; i < state_words; i++) {
+                            A[0] += c.sparse_rows[r][i - 1] * A[i];
+                            A[i] += c.sparse_columns[r][i - 1] * a0;
+                        }
+                    }
+
+                    static inner_matrix_type inverse(inner_matrix_type A) {
+                        constexpr const std::size_t n = state_words - 1;
+
+                        inner_matrix_type result;
+                        for (std::size_t i = 0; i < n; i++) {
+                            for (std::size_t j = 0; j < n; j++) {
+                                result[i][j] = (i == j) ? element_type::one() : element_type::zero();
+                            }
+                        }
+
+                        for (std::size_t col = 0; col < n; col++) {
+                            std::size_t pivot = col;
+                            while (pivot < n && A[pivot][col].is_zero()) {
+                                pivot++;
+                            }
+                            BOOST_ASSERT_MSG(pivot < n, "Poseidon MDS submatrix is not invertible.");
+                            std::swap(A[pivot], A[col]);
+                            std::swap(result[pivot], result[col]);
+
+                            const element_type pivot_inverse = A[col][col].inversed();
+                            for (std::size_t j = 0; j < n; j++) {
+                                A[col][j] *= pivot_inverse;
+                                result[col][j] *= pivot_inverse;
+                            }
+
+                            for (std::size_t i = 0; i < n; i++) {
+                                if (i == col || A[i][col].is_zero()) {
+                                    continue;
+                                }
+                                const element_type factor = A[i][col];
+                                for (std::size_t j = 0; j < n; j++) {
+                                    A[i][j] -= factor * A[col][j];
+                                    result[i][j] -= factor * result[col][j];
+                                }
+                            }
+                        }
+                        return result;
+                    }
+
+                    static inner_vector_type product(const inner_matrix_type &M, const inner_vector_type &v) {
+                        inner_vector_type result;
+                        for (std::size_t i = 0; i < state_words - 1; i++) {
+                            result[i] = M[i][0] * v[0];
+                            for (std::size_t j = 1; j < state_words - 1; j++) {
+                                result[i] += M[i][j] * v[j];
+                            }
+                        }
+                        return result;
+                    }
+
+                    static constants_type generate_constants() {
+                        constants_type c;
+
+                        for (std::size_t i = 0; i < state_words; i++) {
+                            for (std::size_t j = 0; j < state_words; j++) {
+                                c.mds_matrix[i][j] = poseidon_constants_type::mds_matrix[j][i];
+                            }
+                        }
+
+                        if constexpr (part_rounds > 0) {
+                            // Fold the constants backwards: the constants of round r are split into a scalar added
+                            // to the first word before the S-box and a vector moved behind the previous MDS layer,
+                            // where it commutes with the S-box of the first word.
+                            std::array<state_type, part_rounds> folded;
+                            for (std::size_t r = 0; r < part_rounds; r++) {
+                                for (std::size_t i = 0; i < state_words; i++) {
+                                    folded[r][i] = poseidon_constants_type::round_constant(half_full_rounds + r, i);
+                                }
+                            }
+
+                            inner_matrix_type mds_inner;
+                            for (std::size_t i = 1; i < state_words; i++) {
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    mds_inner[i - 1][j - 1] = c.mds_matrix[i][j];
+                                }
+                            }
+                            const inner_matrix_type mds_inner_inverse = inverse(mds_inner);
+
+                            c.part_round_constants[0] = element_type::zero();
+                            for (std::size_t r = part_rounds - 1; r > 0; r--) {
+                                inner_vector_type tail;
+                                std::copy(folded[r].begin() + 1, folded[r].end(), tail.begin());
+                                const inner_vector_type moved = product(mds_inner_inverse, tail);
+
+                                element_type scalar = folded[r][0];
+                                for (std::size_t j = 1; j < state_words; j++) {
+                                    scalar -= c.mds_matrix[0][j] * moved[j - 1];
+                                    folded[r - 1][j] += moved[j - 1];
+                                }
+                                c.part_round_constants[r] = scalar;
+                            }
+
+                            // Factor the accumulated matrix of every partial round as sparse * (1 (+) M') and push
+                            // the (1 (+) M') factor into the previous round.
+                            matrix_type accumulated = c.mds_matrix;
+                            for (std::size_t r = part_rounds; r-- > 0;) {
+                                inner_matrix_type inner;
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    for (std::size_t j = 1; j < state_words; j++) {
+                                        inner[i - 1][j - 1] = accumulated[i][j];
+                                    }
+                                }
+                                const inner_matrix_type inner_inverse = inverse(inner);
+
+                                for (std::size_t j = 0; j < state_words - 1; j++) {
+                                    c.sparse_rows[r][j] = accumulated[0][1] * inner_inverse[0][j];
+                                    for (std::size_t i = 1; i < state_words - 1; i++) {
+                                        c.sparse_rows[r][j] += accumulated[0][i + 1] * inner_inverse[i][j];
+                                    }
+                                    c.sparse_columns[r][j] = accumulated[j + 1][0];
+                                }
+
+                                if (r == 0) {
+                                    c.pre_sparse_matrix = inner;
+                                    break;
+                                }
+
+                                accumulated[0] = c.mds_matrix[0];
+                                for (std::size_t i = 1; i < state_words; i++) {
+                                    for (std::size_t j = 0; j < state_words; j++) {
+                                        accumulated[i][j] = inner[i - 1][0] * c.mds_matrix[1][j];
+                                        for (std::size_t k = 2; k < state_words; k++) {
+                                            accumulated[i][j] += inner[i - 1][k - 1] * c.mds_matrix[k][j];
+                                        }
+                                    }
+                                }
+                            }
+
+                            inner_vector_type first_tail;
+                            std::copy(folded[0].begin() + 1, folded[0].end(), first_tail.begin());
+                            const inner_vector_type first_moved = product(c.pre_sparse_matrix, first_tail);
+                            c.first_part_round_constants[0] = folded[0][0];
+                            std::copy(first_moved.begin(), first_moved.end(), c.first_part_round_constants.begin() + 1);
+                        }
+
+                        return c;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_POSEIDON_OPTIMIZED_PERMUTATION_HPP
@@ -12,6 +12,7 @@
 
 #include <nil/crypto3/hash/detail/poseidon/poseidon_policy.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_round_operator.hpp>
+#include <nil/crypto3/hash/detail/poseidon/poseidon_optimized_permutation.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -40,7 +41,31 @@ namespace nil {
                     constexpr static const std::size_t word_bits = policy_type::word_bits;
                     typedef typename policy_type::word_type word_type;
 
-                    constexpr static inline void permute(state_type &A) {
+                    /// Original policies go through the optimized partial rounds, Mina policies have none.
+                    constexpr static const bool is_optimized = !is_mina_poseidon_policy<policy_type>::value;
+
+                    static inline void permute(state_type &A) {
+                        if constexpr (is_optimized) {
+                            poseidon_optimized_permutation<policy_type>::permute(A);
+                        } else {
+                            permute_reference(A);
+                        }
+                    }
+
+                    /// Permutes every state of [first, last) in place.
+                    template<typename Iterator>
+                    static inline void permute_many(Iterator first, Iterator last) {
+                        if constexpr (is_optimized) {
+                            poseidon_optimized_permutation<policy_type>::permute_many(first, last);
+                        } else {
+                            for (; first != last; ++first) {
+                                permute_reference(*first);
+                            }
+                        }
+                    }
+
+                    /// Round by round permutation, as given in the specification.
+                    constexpr static inline void permute_reference(state_type &A) {
                         std::size_t round_number = 0;
 
                         // Converting from std::array to algebra::vector here.
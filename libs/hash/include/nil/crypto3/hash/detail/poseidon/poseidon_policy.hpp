@@ -123,6 +123,12 @@ namespace nil {
                 template<typename FieldType>
                 struct mina_poseidon_policy : base_poseidon_policy<FieldType, 128, 2, 1, 7, 55, 0> {
                 };
+
+                template<typename PolicyType>
+                struct is_mina_poseidon_policy : std::false_type { };
+
+                template<typename FieldType>
+                struct is_mina_poseidon_policy<mina_poseidon_policy<FieldType>> : std::true_type { };
             } // namespace detail
         } // namespace hashes
     } // namespace crypto3
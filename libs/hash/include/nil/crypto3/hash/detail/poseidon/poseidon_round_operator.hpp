@@ -20,8 +20,24 @@ namespace nil {
         namespace hashes {
             namespace detail {
 
-                // TODO(martun): Poseidon paper describes an optimized round, which can work faster when
-                // the Rate is high. Consider implementing it later.
+                /// S-box x^Power. The powers used by the policies get a fixed multiplication chain.
+                template<std::size_t Power, typename ElementType>
+                constexpr inline ElementType poseidon_sbox(const ElementType &x) {
+                    if constexpr (Power == 5) {
+                        const ElementType x2 = x * x;
+                        const ElementType x4 = x2 * x2;
+                        return x4 * x;
+                    } else if constexpr (Power == 7) {
+                        const ElementType x2 = x * x;
+                        const ElementType x3 = x2 * x;
+                        const ElementType x4 = x2 * x2;
+                        return x4 * x3;
+                    } else {
+                        return x.pow(Power);
+                    }
+                }
+
+                // The optimized partial rounds from the Poseidon paper live in poseidon_optimized_permutation.
                 template<typename PolicyType>
                 class poseidon_round_operator;
 
@@ -52,7 +68,7 @@ namespace nil {
 
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += poseidon_constants_type::round_constant(round_number, i);
-                            A[i] = A[i].pow(sbox_power);
+                            A[i] = poseidon_sbox<sbox_power>(A[i]);
                         }
                         poseidon_constants_type::product_with_mds_matrix(A);
                     }
@@ -64,7 +80,7 @@ namespace nil {
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += poseidon_constants_type::round_constant(round_number, i);
                         }
-                        A[0] = A[0].pow(sbox_power);
+                        A[0] = poseidon_sbox<sbox_power>(A[0]);
                         poseidon_constants_type::product_with_mds_matrix(A);
                     }
                 };
@@ -96,7 +112,7 @@ namespace nil {
                                          "Wrong usage of the Full round function of Mina Poseidon.");
 
                         for (std::size_t i = 0; i < state_words; i++) {
-                            A[i] = A[i].pow(sbox_power);
+                            A[i] = poseidon_sbox<sbox_power>(A[i]);
                         }
 
                         poseidon_constants_type::product_with_mds_matrix(A);
@@ -110,7 +126,7 @@ namespace nil {
                         BOOST_ASSERT_MSG(round_number >= half_full_rounds &&
                                          round_number < half_full_rounds + part_rounds,
                                          "Wrong usage of the part round function of Mina Poseidon.");
-                        A[0] = A[0].pow(sbox_power);
+                        A[0] = poseidon_sbox<sbox_power>(A[0]);
                         poseidon_constants_type::product_with_mds_matrix(A);
                         for (std::size_t i = 0; i < state_words; i++) {
                             A[i] += poseidon_constants_type::round_constant(round_number, i);
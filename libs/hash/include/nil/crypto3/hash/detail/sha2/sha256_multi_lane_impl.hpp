@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_SHA256_MULTI_LANE_IMPL_HPP
+#define CRYPTO3_SHA256_MULTI_LANE_IMPL_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/config.hpp>
+#include <boost/endian/conversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-256 over Lanes independent messages of the same length at once.
+                 *
+                 * VectorType holds the same 32-bit word of every message, one per lane. It has to support
+                 * the builtin integer operators and subscripting, as GCC and Clang vector extensions do.
+                 * Instantiate it from a function compiled for the matching instruction set.
+                 */
+                template<typename VectorType, std::size_t Lanes>
+                struct sha256_multi_lane_impl {
+                    typedef VectorType vector_type;
+                    typedef std::array<vector_type, 8> state_type;
+
+                    constexpr static const std::size_t lanes = Lanes;
+                    constexpr static const std::size_t block_bytes = 64;
+                    constexpr static const std::size_t digest_bytes = 32;
+
+                    constexpr static const std::array<std::uint32_t, 8> iv = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
+                                                                              0xa54ff53a, 0x510e527f, 0x9b05688c,
+                                                                              0x1f83d9ab, 0x5be0cd19};
+
+                    constexpr static const std::array<std::uint32_t, 64> constants = {
+                        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+                    BOOST_FORCEINLINE static void compress(state_type &H, const std::uint8_t *const *blocks,
+                                                           std::size_t offset) {
+                        vector_type W[16];
+                        for (std::size_t t = 0; t < 16; ++t) {
+                            for (std::size_t l = 0; l < lanes; ++l) {
+                                std::uint32_t word;
+                                std::memcpy(&word, blocks[l] + offset + 4 * t, 4);
+                                W[t][l] = boost::endian::big_to_native(word);
+                            }
+                        }
+
+                        vector_type a = H[0], b = H[1], c = H[2], d = H[3], e = H[4], f = H[5], g = H[6], h = H[7];
+                        for (std::size_t t = 0; t < 64; ++t) {
+                            // The message schedule is kept as a ring of the last 16 words
+                            if (t >= 16) {
+                                const vector_type &w15 = W[(t - 15) % 16], &w2 = W[(t - 2) % 16];
+                                const vector_type s0 =
+                                    ((w15 >> 7) | (w15 << 25)) ^ ((w15 >> 18) | (w15 << 14)) ^ (w15 >> 3);
+                                const vector_type s1 =
+                                    ((w2 >> 17) | (w2 << 15)) ^ ((w2 >> 19) | (w2 << 13)) ^ (w2 >> 10);
+                                W[t % 16] += s0 + W[(t - 7) % 16] + s1;
+                            }
+                            const vector_type S1 = ((e >> 6) | (e << 26)) ^ ((e >> 11) | (e << 21)) ^ ((e >> 25) | (e << 7));
+                            const vector_type ch = (e & f) ^ (~e & g);
+                            const vector_type t1 = h + S1 + ch + constants[t] + W[t % 16];
+                            const vector_type S0 = ((a >> 2) | (a << 30)) ^ ((a >> 13) | (a << 19)) ^ ((a >> 22) | (a << 10));
+                            const vector_type maj = (a & b) ^ (a & c) ^ (b & c);
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = d + t1;
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = t1 + S0 + maj;
+                        }
+
+                        H[0] += a;
+                        H[1] += b;
+                        H[2] += c;
+                        H[3] += d;
+                        H[4] += e;
+                        H[5] += f;
+                        H[6] += g;
+                        H[7] += h;
+                    }
+
+                    //! digests[l] = SHA-256(messages[l]), every message is length bytes long
+                    BOOST_FORCEINLINE static void hash(const std::uint8_t *const *messages, std::size_t length,
+                                                       std::uint8_t *const *digests) {
+                        state_type H;
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            H[i] = vector_type {} + iv[i];
+                        }
+
+                        const std::size_t full_blocks_bytes = length - length % block_bytes;
+                        for (std::size_t offset = 0; offset < full_blocks_bytes; offset += block_bytes) {
+                            compress(H, messages, offset);
+                        }
+
+                        // The tail, 0x80 and the 64-bit length take one or two blocks
+                        const std::size_t tail_bytes = length - full_blocks_bytes;
+                        const std::size_t padded_bytes = tail_bytes + 9 > block_bytes ? 2 * block_bytes : block_bytes;
+                        const std::uint64_t length_bits = boost::endian::native_to_big(std::uint64_t(length) * 8);
+                        std::uint8_t tails[lanes][2 * block_bytes] = {};
+                        const std::uint8_t *tail_pointers[lanes];
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            if (tail_bytes) {
+                                std::memcpy(tails[l], messages[l] + full_blocks_bytes, tail_bytes);
+                            }
+                            tails[l][tail_bytes] = 0x80;
+                            std::memcpy(tails[l] + padded_bytes - 8, &length_bits, 8);
+                            tail_pointers[l] = tails[l];
+                        }
+                        for (std::size_t offset = 0; offset < padded_bytes; offset += block_bytes) {
+                            compress(H, tail_pointers, offset);
+                        }
+
+                        for (std::size_t l = 0; l < lanes; ++l) {
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                const std::uint32_t word = boost::endian::native_to_big(std::uint32_t(H[i][l]));
+                                std::memcpy(digests[l] + 4 * i, &word, 4);
+                            }
+                        }
+                    }
+                };
+            }    // namespace detail
+        }        // namespace hashes
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_SHA256_MULTI_LANE_IMPL_HPP
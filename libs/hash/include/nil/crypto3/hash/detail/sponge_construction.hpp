@@ -88,14 +88,21 @@ namespace nil {
                     std::array<word_type, digest_words> squeezed_blocks_holder;
                     constexpr static std::size_t blocks_needed_for_digest =
                             digest_bits / block_bits + (digest_bits % block_bits == 0 ? 0 : 1);
+                    if (!permutation_was_made_) {
+                        Permutator::permute(state_);
+                        permutation_was_made_ = true;
+                    }
                     for (std::size_t i = 0; i < blocks_needed_for_digest; ++i) {
                         std::size_t dest_offset = i * block_words;
-                        block_type squeezed = squeeze();
+                        // Same blocks as repeated squeeze(), without permuting again after the last one
+                        if (i > 0) {
+                            Permutator::permute(state_);
+                        }
                         // TODO: check if this will break in case >1. sinse there could be not enough squeezed_blocks_holder
                         pack_from<endian_type, word_bits, word_bits>(
-                                squeezed.begin(),
-                                squeezed.begin() +
-                                std::min(squeezed.size(), squeezed_blocks_holder.size() - dest_offset),
+                                state_.begin(),
+                                state_.begin() +
+                                std::min(std::size_t(block_words), squeezed_blocks_holder.size() - dest_offset),
                                 squeezed_blocks_holder.begin() + dest_offset
                         );
                     }
@@ -28,6 +28,8 @@
 
 #include <array>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 
 #include <nil/crypto3/detail/pack.hpp>
 
@@ -74,14 +76,50 @@ namespace nil {
 
             protected:
                 inline void process_block(std::size_t block_seen = block_bits) {
+                    process_block(cache.begin(), cache.end(), block_seen);
+                }
+
+                template<typename InputIterator>
+                inline void process_block(InputIterator first, InputIterator last,
+                                          std::size_t block_seen = block_bits) {
                     using namespace nil::crypto3::detail;
                     // Convert the input into words
                     block_type block;
-                    pack_to<endian_type, value_bits, word_bits>(cache.begin(), cache.end(), block.begin());
+                    pack_to<endian_type, value_bits, word_bits>(first, last, block.begin());
                     // Process the block
                     acc(block, ::nil::crypto3::accumulators::bits = block_seen);
                 }
 
+                /*!
+                 * @brief Input values can be packed straight from the caller's buffer when they are
+                 * integers of exactly value_bits in a randomly accessible buffer. Signed values are
+                 * only accepted through pointers, which are reinterpreted as pointers to value_type.
+                 */
+                template<typename InputIterator>
+                struct is_block_packable {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+
+                    constexpr static const bool value =
+                        std::is_base_of<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<InputIterator>::iterator_category>::value &&
+                        std::is_integral<input_value_type>::value && !std::is_same<input_value_type, bool>::value &&
+                        std::numeric_limits<input_value_type>::digits +
+                                std::numeric_limits<input_value_type>::is_signed ==
+                            value_bits &&
+                        (std::is_unsigned<input_value_type>::value || std::is_pointer<InputIterator>::value);
+                };
+
+                template<typename InputIterator>
+                static inline auto as_block_input(InputIterator p) {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+                    if constexpr (std::is_pointer<InputIterator>::value && std::is_signed<input_value_type>::value) {
+                        BOOST_STATIC_ASSERT(sizeof(input_value_type) == sizeof(value_type));
+                        return reinterpret_cast<const value_type *>(p);
+                    } else {
+                        return p;
+                    }
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -95,15 +133,35 @@ namespace nil {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
-                    for (; n; --n) {
-                        update_one(*p++);
+                    if constexpr (is_block_packable<InputIterator>::value) {
+                        // Complete the cached block, then pack whole blocks straight from the input
+                        // and cache only the tail.
+                        for (; n && cache_seen; --n) {
+                            update_one(*p++);
+                        }
+                        auto first = as_block_input(p);
+                        for (; n >= block_values; n -= block_values) {
+                            process_block(first, first + block_values);
+                            first += block_values;
+                        }
+                        for (; n; --n) {
+                            update_one(*first++);
+                        }
+                    } else {
+                        for (; n; --n) {
+                            update_one(*p++);
+                        }
                     }
                 }
 
                 template<typename InputIterator>
                 inline void operator()(InputIterator b, InputIterator e) {
-                    while (b != e) {
-                        update_one(*b++);
+                    if constexpr (is_block_packable<InputIterator>::value) {
+                        update_n(b, std::distance(b, e));
+                    } else {
+                        while (b != e) {
+                            update_one(*b++);
+                        }
                     }
                 }
 
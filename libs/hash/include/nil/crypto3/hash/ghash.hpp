@@ -0,0 +1,219 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_GHASH_HPP
+#define CRYPTO3_HASH_GHASH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/hash/detail/ghash/ghash_impl.hpp>
+#include <nil/crypto3/hash/detail/ghash/ghash_clmul_impl.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief GHASH, the universal hash of GCM and GMAC.
+             * @ingroup hashes
+             *
+             * Keyed with H = E_K(0^128). Associated data is absorbed first, then the ciphertext; both are
+             * zero-padded to a whole block, and final() appends their bit lengths. Uses PCLMULQDQ with
+             * eight-block aggregated reduction when the CPU supports it and a constant-time portable
+             * multiplication otherwise.
+             */
+            class ghash {
+            public:
+                constexpr static const std::size_t block_bits = 128;
+                constexpr static const std::size_t block_bytes = block_bits / 8;
+                typedef std::array<std::uint8_t, block_bytes> block_type;
+
+                typedef block_type key_type;
+                constexpr static const std::size_t digest_bits = block_bits;
+                typedef block_type digest_type;
+
+                ghash() : h {0, 0}, use_clmul(false) {
+                    reset();
+                }
+
+                explicit ghash(const key_type &key) : ghash() {
+                    set_key(key);
+                }
+
+                ~ghash() {
+                    h[0] = h[1] = 0;
+                    std::memset(powers, 0, sizeof(powers));
+                    reset();
+                }
+
+                void set_key(const key_type &key) {
+                    h[0] = detail::ghash_impl::load_be64(key.data());
+                    h[1] = detail::ghash_impl::load_be64(key.data() + 8);
+#ifdef CRYPTO3_HASH_GHASH_CLMUL
+                    use_clmul = clmul_supported();
+                    if (use_clmul) {
+                        detail::ghash_clmul_impl::schedule_key(h, powers);
+                    }
+#endif
+                    reset();
+                }
+
+                void reset() {
+                    y[0] = y[1] = 0;
+                    buffer.fill(0);
+                    buffer_size = 0;
+                    associated_data_bytes = 0;
+                    text_bytes = 0;
+                }
+
+                /// Absorbs associated data. All of it must come before the first update().
+                void update_associated_data(const std::uint8_t *data, std::size_t length) {
+                    BOOST_ASSERT_MSG(text_bytes == 0, "GHASH associated data must precede the ciphertext");
+                    absorb(data, length);
+                    associated_data_bytes += length;
+                }
+
+                /// Absorbs ciphertext.
+                void update(const std::uint8_t *data, std::size_t length) {
+                    if (text_bytes == 0 && length > 0) {
+                        pad_buffer();
+                    }
+                    absorb(data, length);
+                    text_bytes += length;
+                }
+
+                /// Appends the length block and returns GHASH(A, C). The hash is reset afterwards.
+                digest_type final() {
+                    pad_buffer();
+
+                    block_type lengths;
+                    detail::ghash_impl::store_be64(lengths.data(), associated_data_bytes * 8);
+                    detail::ghash_impl::store_be64(lengths.data() + 8, text_bytes * 8);
+                    multiply_blocks(y, lengths.data(), 1);
+
+                    digest_type result;
+                    detail::ghash_impl::store_be64(result.data(), y[0]);
+                    detail::ghash_impl::store_be64(result.data() + 8, y[1]);
+
+                    reset();
+                    return result;
+                }
+
+                /// GCM pre-counter block for nonces which are not 96 bits long.
+                digest_type nonce_hash(const std::uint8_t *nonce, std::size_t length) const {
+                    std::uint64_t acc[2] = {0, 0};
+
+                    const std::size_t full_blocks = length / block_bytes;
+                    multiply_blocks(acc, nonce, full_blocks);
+
+                    block_type block;
+                    if (length % block_bytes) {
+                        block.fill(0);
+                        std::memcpy(block.data(), nonce + full_blocks * block_bytes, length % block_bytes);
+                        multiply_blocks(acc, block.data(), 1);
+                    }
+
+                    detail::ghash_impl::store_be64(block.data(), 0);
+                    detail::ghash_impl::store_be64(block.data() + 8, static_cast<std::uint64_t>(length) * 8);
+                    multiply_blocks(acc, block.data(), 1);
+
+                    digest_type result;
+                    detail::ghash_impl::store_be64(result.data(), acc[0]);
+                    detail::ghash_impl::store_be64(result.data() + 8, acc[1]);
+                    return result;
+                }
+
+            private:
+#ifdef CRYPTO3_HASH_GHASH_CLMUL
+                static bool clmul_supported() {
+                    static const bool supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+                    return supported;
+                }
+#endif
+
+                void multiply_blocks(std::uint64_t acc[2], const std::uint8_t *data, std::size_t blocks) const {
+#ifdef CRYPTO3_HASH_GHASH_CLMUL
+                    if (use_clmul) {
+                        detail::ghash_clmul_impl::multiply_blocks(acc, powers, data, blocks);
+                        return;
+                    }
+#endif
+                    detail::ghash_impl::multiply_blocks(acc, h, data, blocks);
+                }
+
+                void absorb(const std::uint8_t *data, std::size_t length) {
+                    if (buffer_size > 0) {
+                        const std::size_t take = std::min(length, block_bytes - buffer_size);
+                        std::memcpy(buffer.data() + buffer_size, data, take);
+                        buffer_size += take;
+                        data += take;
+                        length -= take;
+                        if (buffer_size < block_bytes) {
+                            return;
+                        }
+                        multiply_blocks(y, buffer.data(), 1);
+                        buffer_size = 0;
+                    }
+
+                    const std::size_t full_blocks = length / block_bytes;
+                    multiply_blocks(y, data, full_blocks);
+                    data += full_blocks * block_bytes;
+                    length -= full_blocks * block_bytes;
+
+                    std::memcpy(buffer.data(), data, length);
+                    buffer_size = length;
+                }
+
+                void pad_buffer() {
+                    if (buffer_size > 0) {
+                        std::memset(buffer.data() + buffer_size, 0, block_bytes - buffer_size);
+                        multiply_blocks(y, buffer.data(), 1);
+                        buffer_size = 0;
+                    }
+                }
+
+                std::uint64_t h[2];
+#ifdef CRYPTO3_HASH_GHASH_CLMUL
+                detail::ghash_clmul_impl::powers_type powers = {};
+#else
+                std::uint64_t powers[1][2] = {};
+#endif
+                bool use_clmul;
+
+                std::uint64_t y[2];
+                block_type buffer;
+                std::size_t buffer_size;
+                std::uint64_t associated_data_bytes;
+                std::uint64_t text_bytes;
+            };
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_GHASH_HPP
@@ -0,0 +1,335 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_STREAM_HASHER_HPP
+#define CRYPTO3_HASH_STREAM_HASHER_HPP
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/integer.hpp>
+#include <boost/static_assert.hpp>
+
+#include <nil/crypto3/detail/pack.hpp>
+
+#include <nil/crypto3/hash/accumulators/hash.hpp>
+#include <nil/crypto3/hash/detail/block_cache.hpp>
+#include <nil/crypto3/hash/type_traits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Incremental hasher with the init/update/finalize interface that keeps its whole state in
+             * the object: no accumulator_set, no stream processor and no heap allocation on the update path.
+             *
+             * Copying a stream_hasher copies the midstate, so a common prefix can be absorbed once and reused.
+             * finalize() does not modify the hasher. The digests are the ones of hash<HashType> over the
+             * concatenation of all the updates since the last init().
+             *
+             * @tparam HashType hash function
+             * @tparam AccumulatorTag accumulator of HashType, selects the implementation
+             */
+            template<typename HashType, typename AccumulatorTag = typename HashType::accumulator_tag>
+            class stream_hasher;
+
+            /*!
+             * @brief Hashes working on blocks of bits: Merkle-Damgård, sponge and HAIFA constructions.
+             *
+             * Every update() packs its values into blocks the way block_stream_processor does, and the
+             * blocks go to a block_cache the way the hash accumulator consumes them.
+             */
+            template<typename HashType>
+            class stream_hasher<HashType, accumulators::tag::hash<HashType>> {
+            public:
+                typedef HashType hash_type;
+                typedef typename hash_type::digest_type digest_type;
+
+            protected:
+                typedef typename hash_type::construction::type construction_type;
+                typedef typename hash_type::construction::params_type params_type;
+
+                // values are packed into words as block_stream_processor does, blocks are cached as
+                // block_acc_impl does
+                typedef typename hash_type::policy_type::digest_endian packing_endian_type;
+                typedef typename params_type::digest_endian endian_type;
+
+                constexpr static const std::size_t word_bits = construction_type::word_bits;
+                typedef typename construction_type::word_type word_type;
+
+                constexpr static const std::size_t block_bits = construction_type::block_bits;
+                constexpr static const std::size_t block_words = construction_type::block_words;
+                typedef typename construction_type::block_type block_type;
+
+                template<typename InputIterator>
+                struct input_traits {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+                    BOOST_STATIC_ASSERT(std::numeric_limits<input_value_type>::is_specialized);
+
+                    constexpr static const std::size_t value_bits =
+                        std::numeric_limits<input_value_type>::digits + std::numeric_limits<input_value_type>::is_signed;
+                    typedef typename boost::uint_t<value_bits>::least value_type;
+                    constexpr static const std::size_t block_values = block_bits / value_bits;
+                    BOOST_STATIC_ASSERT(word_bits % value_bits == 0);
+
+                    // unsigned values of exactly value_bits in a random access buffer are packed in place
+                    constexpr static const bool is_block_packable =
+                        std::is_base_of<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<InputIterator>::iterator_category>::value &&
+                        std::is_integral<input_value_type>::value && std::is_unsigned<input_value_type>::value &&
+                        !std::is_same<input_value_type, bool>::value;
+                };
+
+            public:
+                stream_hasher() {
+                    init();
+                }
+
+                void init() {
+                    construction.reset();
+                    cache.clean();
+                    total_seen = 0;
+                }
+
+                template<typename InputIterator>
+                stream_hasher &update(InputIterator first, InputIterator last) {
+                    typedef input_traits<InputIterator> traits;
+                    typedef typename traits::value_type value_type;
+                    constexpr const std::size_t value_bits = traits::value_bits;
+                    constexpr const std::size_t block_values = traits::block_values;
+
+                    std::array<value_type, block_values> values = {};
+                    std::size_t values_seen = 0;
+                    if constexpr (traits::is_block_packable) {
+                        std::size_t n = std::distance(first, last);
+                        for (; n >= block_values; n -= block_values) {
+                            process_values(first, first + block_values, block_bits);
+                            first += block_values;
+                        }
+                        values_seen = std::copy(first, last, values.begin()) - values.begin();
+                    } else {
+                        for (; first != last; ++first) {
+                            values[values_seen++] = *first;
+                            if (values_seen == block_values) {
+                                process_values(values.begin(), values.end(), block_bits);
+                                values_seen = 0;
+                            }
+                        }
+                    }
+                    if (values_seen > 0) {
+                        process_values(values.begin(), values.end(), values_seen * value_bits);
+                    }
+                    return *this;
+                }
+
+                template<typename SinglePassRange>
+                stream_hasher &update(const SinglePassRange &range) {
+                    return update(std::begin(range), std::end(range));
+                }
+
+                template<typename T>
+                stream_hasher &update(std::initializer_list<T> list) {
+                    return update(list.begin(), list.end());
+                }
+
+                digest_type finalize() const {
+                    construction_type res = construction;
+                    if constexpr (is_sponge_construction<construction_type>::value) {
+                        res.absorb_with_padding(cache.get_block(), cache.bits_used());
+                        return res.digest();
+                    } else {
+                        return res.digest(cache.get_block(), total_seen);
+                    }
+                }
+
+            protected:
+                template<typename InputIterator>
+                void process_values(InputIterator first, InputIterator last, std::size_t bits_seen) {
+                    constexpr const std::size_t value_bits = input_traits<InputIterator>::value_bits;
+
+                    block_type block;
+                    ::nil::crypto3::detail::pack_to<packing_endian_type, value_bits, word_bits>(first, last,
+                                                                                                block.begin());
+                    process(block, bits_seen);
+                }
+
+                void process(const block_type &block, std::size_t bits_seen) {
+                    std::size_t processed_bits = 0;
+                    while (processed_bits < bits_seen) {
+                        std::size_t bits_to_append =
+                            std::min(cache.capacity() - cache.bits_used(), bits_seen - processed_bits);
+
+                        cache.append(block, bits_to_append, processed_bits);
+                        processed_bits += bits_to_append;
+
+                        if (cache.is_full()) {
+                            if constexpr (is_sponge_construction<construction_type>::value) {
+                                construction.absorb(cache.get_block());
+                            } else {
+                                construction.process_block(cache.get_block());
+                            }
+                            cache.clean();
+                        }
+                    }
+                    total_seen += bits_seen;
+                }
+
+                construction_type construction;
+                block_cache<block_type, word_type, word_bits, block_words, endian_type> cache;
+                std::size_t total_seen;
+            };
+
+            /*!
+             * @brief Algebraic hashes (Poseidon) absorbing field elements word by word.
+             */
+            template<typename HashType>
+            class stream_hasher<HashType, accumulators::tag::algebraic_hash<HashType>> {
+            public:
+                typedef HashType hash_type;
+                typedef typename hash_type::digest_type digest_type;
+
+            protected:
+                typedef typename hash_type::construction::type construction_type;
+
+                typedef typename construction_type::word_type word_type;
+                constexpr static const std::size_t block_words = construction_type::block_words;
+                typedef typename construction_type::block_type block_type;
+
+            public:
+                stream_hasher() {
+                    init();
+                }
+
+                void init() {
+                    construction.reset();
+                    cache.clean();
+                }
+
+                stream_hasher &update(const word_type &word) {
+                    cache.append(word);
+                    if (cache.is_full()) {
+                        construction.absorb(cache.get_block());
+                        cache.clean();
+                    }
+                    return *this;
+                }
+
+                template<typename InputIterator>
+                stream_hasher &update(InputIterator first, InputIterator last) {
+                    for (; first != last; ++first) {
+                        update(*first);
+                    }
+                    return *this;
+                }
+
+                template<typename SinglePassRange>
+                typename std::enable_if<!std::is_convertible<SinglePassRange, word_type>::value, stream_hasher &>::type
+                    update(const SinglePassRange &range) {
+                    return update(std::begin(range), std::end(range));
+                }
+
+                digest_type finalize() const {
+                    construction_type res = construction;
+                    res.absorb_with_padding(cache.get_block(), cache.words_used());
+                    return res.digest();
+                }
+
+            protected:
+                construction_type construction;
+                algebra_block_cache<block_type, word_type, block_words> cache;
+            };
+
+            /*!
+             * @brief Hashes which keep their own accumulator (hash to field, hash to curve, Pedersen).
+             */
+            template<typename HashType>
+            class stream_hasher<HashType, accumulators::tag::forwarding_hash<HashType>> {
+            public:
+                typedef HashType hash_type;
+                typedef typename hash_type::result_type digest_type;
+
+            protected:
+                typedef typename hash_type::accumulator_type accumulator_type;
+
+            public:
+                stream_hasher() {
+                    init();
+                }
+
+                void init() {
+                    acc = accumulator_type();
+                    hash_type::init_accumulator(acc);
+                }
+
+                template<typename InputIterator>
+                stream_hasher &update(InputIterator first, InputIterator last) {
+                    hash_type::update(acc, first, last);
+                    return *this;
+                }
+
+                template<typename SinglePassRange>
+                stream_hasher &update(const SinglePassRange &range) {
+                    hash_type::update(acc, range);
+                    return *this;
+                }
+
+                digest_type finalize() const {
+                    return hash_type::process(acc);
+                }
+
+            protected:
+                mutable accumulator_type acc;
+            };
+
+            /*!
+             * @brief One-shot hash of a range through stream_hasher, equal to hash<HashType>(range).
+             */
+            template<typename HashType, typename SinglePassRange>
+            typename stream_hasher<HashType>::digest_type hash_once(const SinglePassRange &range) {
+                stream_hasher<HashType> hasher;
+                hasher.update(range);
+                return hasher.finalize();
+            }
+
+            template<typename HashType, typename InputIterator>
+            typename stream_hasher<HashType>::digest_type hash_once(InputIterator first, InputIterator last) {
+                stream_hasher<HashType> hasher;
+                hasher.update(first, last);
+                return hasher.finalize();
+            }
+
+            template<typename HashType, typename T>
+            typename stream_hasher<HashType>::digest_type hash_once(std::initializer_list<T> list) {
+                return hash_once<HashType>(list.begin(), list.end());
+            }
+        }    // namespace hashes
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_STREAM_HASHER_HPP
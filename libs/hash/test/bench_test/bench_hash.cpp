@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE hash_throughput_bench_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/stream_hasher.hpp>
+
+using namespace nil::crypto3;
+
+std::vector<std::uint8_t> generate_message(std::size_t size) {
+    std::mt19937 gen(0x5eed);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<std::uint8_t> message(size);
+    for (auto &byte : message) {
+        byte = static_cast<std::uint8_t>(distrib(gen));
+    }
+    return message;
+}
+
+// Hides the random access of the underlying buffer, so the input goes through the value by value path
+struct forward_byte_iterator {
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::uint8_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::uint8_t *pointer;
+    typedef const std::uint8_t &reference;
+
+    reference operator*() const {
+        return *p;
+    }
+    forward_byte_iterator &operator++() {
+        ++p;
+        return *this;
+    }
+    forward_byte_iterator operator++(int) {
+        forward_byte_iterator tmp = *this;
+        ++p;
+        return tmp;
+    }
+    bool operator==(const forward_byte_iterator &other) const {
+        return p == other.p;
+    }
+    bool operator!=(const forward_byte_iterator &other) const {
+        return p != other.p;
+    }
+
+    const std::uint8_t *p;
+};
+
+double get_sec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(timepoint.time_since_epoch()).count();
+}
+
+template<typename HashType>
+void print_throughput_csv(const char *name) {
+    typedef typename HashType::digest_type digest_type;
+    const std::size_t total_bytes = std::size_t(1) << 26;
+
+    printf("%s\nmessage, bytes\tvalue by value, MB/s\tbulk, MB/s\n", name);
+    for (std::size_t size : {std::size_t(64), std::size_t(1) << 10, std::size_t(1) << 20}) {
+        const std::vector<std::uint8_t> message = generate_message(size);
+        const std::size_t iterations = total_bytes / size;
+        const double megabytes = double(iterations * size) / (1 << 20);
+
+        digest_type by_value, bulk;
+        double start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            by_value = hash<HashType>(forward_byte_iterator {message.data()},
+                                      forward_byte_iterator {message.data() + message.size()});
+        }
+        double by_value_time = get_sec_time() - start_time;
+
+        start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            bulk = hash<HashType>(message);
+        }
+        double bulk_time = get_sec_time() - start_time;
+
+        printf("%zu\t%.1f\t%.1f\n", size, megabytes / by_value_time, megabytes / bulk_time);
+        fflush(stdout);
+
+        BOOST_CHECK(by_value == bulk);
+    }
+}
+
+template<typename HashType>
+void print_call_overhead_csv(const char *name) {
+    typedef typename HashType::digest_type digest_type;
+    const std::size_t iterations = 1 << 20;
+
+    printf("%s\nmessage, bytes\thash<>, ns/call\thash_once, ns/call\n", name);
+    for (std::size_t size : {std::size_t(0), std::size_t(32), std::size_t(64), std::size_t(200)}) {
+        const std::vector<std::uint8_t> message = generate_message(size);
+
+        digest_type accumulated, one_shot;
+        double start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            accumulated = hash<HashType>(message);
+        }
+        double accumulated_time = get_sec_time() - start_time;
+
+        start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            one_shot = hashes::hash_once<HashType>(message);
+        }
+        double one_shot_time = get_sec_time() - start_time;
+
+        printf("%zu\t%.1f\t%.1f\n", size, accumulated_time * 1e9 / iterations, one_shot_time * 1e9 / iterations);
+        fflush(stdout);
+
+        BOOST_CHECK(accumulated == one_shot);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(hash_throughput_bench)
+
+BOOST_AUTO_TEST_CASE(sha2_256_throughput_bench) {
+    print_throughput_csv<hashes::sha2<256>>("sha2<256>");
+}
+
+BOOST_AUTO_TEST_CASE(sha2_512_throughput_bench) {
+    print_throughput_csv<hashes::sha2<512>>("sha2<512>");
+}
+
+BOOST_AUTO_TEST_CASE(sha3_256_throughput_bench) {
+    print_throughput_csv<hashes::sha3<256>>("sha3<256>");
+}
+
+BOOST_AUTO_TEST_CASE(keccak_1600_256_throughput_bench) {
+    print_throughput_csv<hashes::keccak_1600<256>>("keccak_1600<256>");
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_512_throughput_bench) {
+    print_throughput_csv<hashes::blake2b<512>>("blake2b<512>");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(hash_call_overhead_bench)
+
+BOOST_AUTO_TEST_CASE(sha2_256_call_overhead_bench) {
+    print_call_overhead_csv<hashes::sha2<256>>("sha2<256>");
+}
+
+BOOST_AUTO_TEST_CASE(keccak_1600_256_call_overhead_bench) {
+    print_call_overhead_csv<hashes::keccak_1600<256>>("keccak_1600<256>");
+}
+
+BOOST_AUTO_TEST_CASE(blake2b_512_call_overhead_bench) {
+    print_call_overhead_csv<hashes::blake2b<512>>("blake2b<512>");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
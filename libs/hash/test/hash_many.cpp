@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE hash_many_test
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/algorithm/hash_many.hpp>
+
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+
+using namespace nil::crypto3;
+
+// Lengths around the block sizes of SHA-256 (64 bytes, padding needs 9) and Keccak-256 (136 bytes)
+const std::vector<std::size_t> message_lengths = {0, 1, 32, 55, 56, 63, 64, 65, 119, 135, 136, 137, 272, 1000};
+
+std::vector<std::vector<std::uint8_t>> generate_messages(std::size_t count, std::size_t length) {
+    std::mt19937 gen(0x5eed + length);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<std::vector<std::uint8_t>> messages(count, std::vector<std::uint8_t>(length));
+    for (auto &message : messages) {
+        for (auto &byte : message) {
+            byte = static_cast<std::uint8_t>(distrib(gen));
+        }
+    }
+    return messages;
+}
+
+template<typename HashType, typename MessagesType>
+void check_hash_many(const MessagesType &messages) {
+    typedef typename HashType::digest_type digest_type;
+
+    std::vector<digest_type> digests(messages.size());
+    BOOST_CHECK(hash_many<HashType>(messages, digests.begin()) == digests.end());
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        digest_type expected = hash<HashType>(messages[i]);
+        BOOST_CHECK(digests[i] == expected);
+    }
+}
+
+template<typename HashType>
+void check_hash_many_lengths() {
+    // Counts that leave idle lanes for every lane width
+    for (std::size_t length : message_lengths) {
+        for (std::size_t count : {1, 3, 4, 8, 17}) {
+            check_hash_many<HashType>(generate_messages(count, length));
+        }
+    }
+
+    // Runs of equal length messages
+    std::vector<std::vector<std::uint8_t>> messages;
+    for (std::size_t length : message_lengths) {
+        for (auto &message : generate_messages(length % 7 + 1, length)) {
+            messages.emplace_back(std::move(message));
+        }
+    }
+    check_hash_many<HashType>(messages);
+}
+
+BOOST_AUTO_TEST_SUITE(hash_many_test_suite)
+
+BOOST_AUTO_TEST_CASE(hash_many_keccak) {
+    check_hash_many_lengths<hashes::keccak_1600<256>>();
+    check_hash_many_lengths<hashes::keccak_1600<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_many_sha3) {
+    check_hash_many_lengths<hashes::sha3<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_many_sha2) {
+    check_hash_many_lengths<hashes::sha2<256>>();
+    // No multi-lane kernel, goes through hash<> one by one
+    check_hash_many_lengths<hashes::sha2<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_many_message_types) {
+    std::vector<std::array<std::uint8_t, 32>> arrays(9);
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        arrays[i].fill(static_cast<std::uint8_t>(i));
+    }
+    check_hash_many<hashes::keccak_1600<256>>(arrays);
+
+    std::vector<std::string> strings = {"abc", "abd", "", "abe", "abf", "abg", "abh", "abi", "abj"};
+    check_hash_many<hashes::sha2<256>>(strings);
+
+    std::vector<hashes::sha2<256>::digest_type> digests(1);
+    hash_many<hashes::sha2<256>>(std::vector<std::string> {"abc"}, digests.begin());
+    BOOST_CHECK_EQUAL("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+                      std::to_string(digests[0]).data());
+}
+
+#ifdef CRYPTO3_HASH_MULTI_LANE_X86_64
+// hash_many uses the widest kernel the CPU has, call the narrower ones directly
+BOOST_AUTO_TEST_CASE(hash_many_avx2_kernels) {
+    if (!__builtin_cpu_supports("avx2")) {
+        return;
+    }
+
+    for (std::size_t length : message_lengths) {
+        std::vector<std::vector<std::uint8_t>> messages = generate_messages(8, length);
+        std::vector<const std::uint8_t *> message_pointers;
+        for (const auto &message : messages) {
+            message_pointers.push_back(message.data());
+        }
+
+        std::array<hashes::keccak_1600<256>::digest_type, 4> keccak_digests;
+        std::array<hashes::sha2<256>::digest_type, 8> sha2_digests;
+        std::array<std::uint8_t *, 8> digest_pointers;
+        for (std::size_t i = 0; i < 4; ++i) {
+            digest_pointers[i] = keccak_digests[i].data();
+        }
+        hashes::detail::keccak_1600_hash_avx2(message_pointers.data(), length, 136, 0x01, digest_pointers.data(), 32);
+        for (std::size_t i = 0; i < 4; ++i) {
+            hashes::keccak_1600<256>::digest_type expected = hash<hashes::keccak_1600<256>>(messages[i]);
+            BOOST_CHECK(keccak_digests[i] == expected);
+        }
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            digest_pointers[i] = sha2_digests[i].data();
+        }
+        hashes::detail::sha256_hash_avx2(message_pointers.data(), length, digest_pointers.data());
+        for (std::size_t i = 0; i < 8; ++i) {
+            hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(messages[i]);
+            BOOST_CHECK(sha2_digests[i] == expected);
+        }
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
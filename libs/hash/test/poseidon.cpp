@@ -92,6 +92,17 @@ void test_poseidon_permutation(typename poseidon_policy<FieldType, 128, Rate>::s
                                typename poseidon_policy<FieldType, 128, Rate>::state_type expected_result) {
     using policy_type = poseidon_policy<FieldType, 128, Rate>;
 
+    // The round by round permutation must agree with the optimized one, also when permuting in batches.
+    typename policy_type::state_type reference = input;
+    poseidon_permutation<policy_type>::permute_reference(reference);
+    BOOST_CHECK_EQUAL(reference, expected_result);
+
+    std::vector<typename policy_type::state_type> states(11, input);
+    poseidon_permutation<policy_type>::permute_many(states.begin(), states.end());
+    for (const auto &state: states) {
+        BOOST_CHECK_EQUAL(state, expected_result);
+    }
+
     // This permutes in place.
     poseidon_permutation<policy_type>::permute(input);
     BOOST_CHECK_EQUAL(input, expected_result);
@@ -26,6 +26,10 @@
 #define BOOST_TEST_MODULE sha2_test
 
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -686,4 +690,33 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
     BOOST_CHECK_EQUAL("23097d223405d8228642a477bda255b32aadbce4bda0b3f7e36c9da7", std::to_string(h).data());
 }
 
+BOOST_AUTO_TEST_CASE(sha256_bulk_input_matches_value_by_value) {
+    std::vector<std::uint8_t> message(1000);
+    for (std::size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    std::list<std::uint8_t> listed(message.begin(), message.end());
+    std::string characters(message.begin(), message.end());
+
+    // Message lengths around the block boundary, fed in pieces that start in the middle of a block
+    for (std::size_t size : {0, 1, 63, 64, 65, 128, 1000}) {
+        hashes::sha2<256>::digest_type expected = hash<hashes::sha2<256>>(
+            listed.begin(), std::next(listed.begin(), size));
+
+        hashes::sha2<256>::digest_type from_vector =
+            hash<hashes::sha2<256>>(message.begin(), message.begin() + size);
+        hashes::sha2<256>::digest_type from_string_iterators =
+            hash<hashes::sha2<256>>(characters.begin(), characters.begin() + size);
+        hashes::sha2<256>::digest_type from_string = hash<hashes::sha2<256>>(std::string(characters, 0, size));
+        BOOST_CHECK(expected == from_vector);
+        BOOST_CHECK(expected == from_string_iterators);
+        BOOST_CHECK(expected == from_string);
+
+        accumulator_set<hashes::sha2<256>> acc;
+        hash<hashes::sha2<256>>(message.begin(), message.begin() + size / 3, acc);
+        hash<hashes::sha2<256>>(message.begin() + size / 3, message.begin() + size, acc);
+        BOOST_CHECK(expected == extract::hash<hashes::sha2<256>>(acc));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE hash_stream_hasher_test
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/stream_hasher.hpp>
+
+#include <nil/crypto3/hash/blake2b.hpp>
+#include <nil/crypto3/hash/keccak.hpp>
+#include <nil/crypto3/hash/md5.hpp>
+#include <nil/crypto3/hash/ripemd.hpp>
+#include <nil/crypto3/hash/sha1.hpp>
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha3.hpp>
+#include <nil/crypto3/hash/tiger.hpp>
+
+using namespace nil::crypto3;
+
+// Lengths around the block sizes of SHA-256 (64 bytes, padding needs 9) and Keccak-256 (136 bytes)
+const std::vector<std::size_t> message_lengths = {0, 1, 32, 55, 56, 63, 64, 65, 119, 135, 136, 137, 272, 1000};
+
+std::vector<std::uint8_t> generate_message(std::size_t length) {
+    std::mt19937 gen(0x5eed + length);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<std::uint8_t> message(length);
+    for (auto &byte : message) {
+        byte = static_cast<std::uint8_t>(distrib(gen));
+    }
+    return message;
+}
+
+template<typename HashType>
+void check_stream_hasher() {
+    typedef typename HashType::digest_type digest_type;
+
+    for (std::size_t length : message_lengths) {
+        const std::vector<std::uint8_t> message = generate_message(length);
+        const digest_type expected = hash<HashType>(message);
+
+        BOOST_CHECK(hashes::hash_once<HashType>(message) == expected);
+
+        // the value by value path
+        const std::list<std::uint8_t> listed(message.begin(), message.end());
+        BOOST_CHECK(hashes::hash_once<HashType>(listed) == expected);
+
+        // updates split at every offset of the first blocks, reusing the midstate of the prefix
+        for (std::size_t split = 0; split <= std::min(length, std::size_t(140)); ++split) {
+            hashes::stream_hasher<HashType> prefix;
+            prefix.update(message.begin(), message.begin() + split);
+
+            hashes::stream_hasher<HashType> hasher = prefix;
+            hasher.update(message.begin() + split, message.end());
+            BOOST_CHECK(hasher.finalize() == expected);
+            // finalize leaves the state alone
+            BOOST_CHECK(hasher.finalize() == expected);
+        }
+
+        hashes::stream_hasher<HashType> reused;
+        reused.update(generate_message(length + 7));
+        reused.init();
+        reused.update(message);
+        BOOST_CHECK(reused.finalize() == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(stream_hasher_test_suite)
+
+BOOST_AUTO_TEST_CASE(stream_hasher_sha2_256) {
+    check_stream_hasher<hashes::sha2<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_sha2_512) {
+    check_stream_hasher<hashes::sha2<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_sha1) {
+    check_stream_hasher<hashes::sha1>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_md5) {
+    check_stream_hasher<hashes::md5>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_ripemd_160) {
+    check_stream_hasher<hashes::ripemd<160>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_tiger) {
+    check_stream_hasher<hashes::tiger<192>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_keccak_1600_256) {
+    check_stream_hasher<hashes::keccak_1600<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_sha3_256) {
+    check_stream_hasher<hashes::sha3<256>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_blake2b_512) {
+    check_stream_hasher<hashes::blake2b<512>>();
+}
+
+BOOST_AUTO_TEST_CASE(stream_hasher_int_words) {
+    // non-octet values are packed as by hash<>, as the transcripts do with {0}
+    typedef hashes::sha2<256> hash_type;
+    BOOST_CHECK(hashes::hash_once<hash_type>({0}) == static_cast<hash_type::digest_type>(hash<hash_type>({0})));
+
+    const std::vector<std::uint32_t> words = {0x01020304, 0xdeadbeef, 0, 42, 0xffffffff};
+    BOOST_CHECK(hashes::hash_once<hash_type>(words) == static_cast<hash_type::digest_type>(hash<hash_type>(words)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
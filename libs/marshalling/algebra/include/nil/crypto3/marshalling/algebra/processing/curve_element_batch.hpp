@@ -0,0 +1,275 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
+#define CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+
+#include <nil/crypto3/marshalling/multiprecision/processing/integral.hpp>
+
+#include <nil/crypto3/marshalling/algebra/processing/curve_element.hpp>
+#include <nil/crypto3/marshalling/algebra/processing/detail/curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace processing {
+                /// @brief How curve_element_batch_reader checks that the decoded points lie in the prime order
+                /// subgroup: not at all (e.g. for groups with cofactor 1), one scalar multiplication per point, or
+                /// a single randomized check of the whole batch.
+                enum class subgroup_check_mode { none, individual, batched };
+
+                /// @brief Flag bits of the first byte of a compressed point: C_bit is set for every compressed
+                /// point (0 if the format has no such bit), I_bit marks the point at infinity and S_bit the sign
+                /// of Y, the same as curve_element_reader.
+                template<typename Endianness, typename GroupType>
+                struct compressed_curve_element_flags;
+
+                template<typename Coordinates>
+                struct compressed_curve_element_flags<
+                    nil::marshalling::endian::big_endian,
+                    typename algebra::curves::bls12_381::template g1_type<Coordinates,
+                                                                          algebra::curves::forms::short_weierstrass>> {
+                    constexpr static const unsigned char C_bit = 0x80;
+                    constexpr static const unsigned char I_bit = 0x40;
+                    constexpr static const unsigned char S_bit = 0x20;
+                };
+
+                template<typename Coordinates>
+                struct compressed_curve_element_flags<
+                    nil::marshalling::endian::big_endian,
+                    typename algebra::curves::bls12_381::template g2_type<Coordinates,
+                                                                          algebra::curves::forms::short_weierstrass>> {
+                    constexpr static const unsigned char C_bit = 0x80;
+                    constexpr static const unsigned char I_bit = 0x40;
+                    constexpr static const unsigned char S_bit = 0x20;
+                };
+
+                template<typename Coordinates>
+                struct compressed_curve_element_flags<
+                    nil::marshalling::endian::big_endian,
+                    typename algebra::curves::alt_bn128_254::template g1_type<
+                        Coordinates, algebra::curves::forms::short_weierstrass>> {
+                    constexpr static const unsigned char C_bit = 0x00;
+                    constexpr static const unsigned char I_bit = 0x80;
+                    constexpr static const unsigned char S_bit = 0x40;
+                };
+
+                template<typename Coordinates>
+                struct compressed_curve_element_flags<
+                    nil::marshalling::endian::big_endian,
+                    typename algebra::curves::alt_bn128_254::template g2_type<
+                        Coordinates, algebra::curves::forms::short_weierstrass>> {
+                    constexpr static const unsigned char C_bit = 0x00;
+                    constexpr static const unsigned char I_bit = 0x80;
+                    constexpr static const unsigned char S_bit = 0x40;
+                };
+
+                namespace detail {
+                    /*
+                     * Square root of a in a prime field, returns false if a is not a square. For p = 3 mod 4 the
+                     * candidate a^((p + 1) / 4) is checked by squaring it, so no separate Legendre symbol is needed.
+                     */
+                    template<typename FieldValueType>
+                    typename std::enable_if<!algebra::is_extended_field<typename FieldValueType::field_type>::value,
+                                            bool>::type
+                        checked_sqrt(const FieldValueType &a, FieldValueType &root) {
+                        typedef typename FieldValueType::integral_type integral_type;
+
+                        if (boost::multiprecision::bit_test(FieldValueType::modulus, 0) &&
+                            boost::multiprecision::bit_test(FieldValueType::modulus, 1)) {
+                            static const integral_type exponent = (FieldValueType::modulus >> 2u) + 1u;
+                            root = a.pow(exponent);
+                            return root.squared() == a;
+                        }
+                        if (!a.is_square()) {
+                            return false;
+                        }
+                        root = a.sqrt();
+                        return true;
+                    }
+
+                    /*
+                     * Square root of a in a quadratic extension, returns false if a is not a square.
+                     * a is a square iff its norm a_0^2 - non_residue * a_1^2 is a square in the base field, which
+                     * is checked there instead of raising a to (p^2 - 1) / 2. The Tonelli-Shanks loop of sqrt()
+                     * does not terminate on non-squares, so it is only entered after this check.
+                     */
+                    template<typename FieldValueType>
+                    typename std::enable_if<algebra::is_extended_field<typename FieldValueType::field_type>::value &&
+                                                FieldValueType::field_type::arity == 2,
+                                            bool>::type
+                        checked_sqrt(const FieldValueType &a, FieldValueType &root) {
+                        typedef typename FieldValueType::underlying_type underlying_type;
+
+                        if (a.is_zero()) {
+                            root = a;
+                            return true;
+                        }
+                        const underlying_type norm =
+                            a.data[0].squared() - FieldValueType::non_residue * a.data[1].squared();
+                        underlying_type norm_root;
+                        if (!checked_sqrt(norm, norm_root)) {
+                            return false;
+                        }
+                        root = a.sqrt();
+                        return true;
+                    }
+                }    // namespace detail
+
+                /// @brief Decodes count consecutive compressed points written by curve_element_writer.
+                /// @details The points are independent, so they are decoded in parallel if MULTICORE is defined,
+                ///     the square root of every point running on its own thread. Unlike curve_element_reader,
+                ///     non-canonical coordinates, points off the curve and, depending on check, points outside of
+                ///     the prime order subgroup are reported as invalid_msg_data.
+                ///     The decoded points have Z = 1, so no inversion is needed.
+                template<typename Endianness, typename GroupType>
+                struct curve_element_batch_reader {
+                    using group_type = GroupType;
+                    using group_value_type = typename group_type::value_type;
+                    using field_type = typename group_value_type::field_type;
+                    using field_value_type = typename field_type::value_type;
+                    using integral_type = typename field_type::integral_type;
+                    using endianness = Endianness;
+                    using params_type = curve_element_marshalling_params<group_type>;
+                    using flags_type = compressed_curve_element_flags<endianness, group_type>;
+
+                    /// @param[out] points Decoded points, resized to count.
+                    /// @param[in] iter Iterator to the first byte of the first point, it is not advanced.
+                    /// @param[in] count Number of points, params_type::length() bytes each.
+                    /// @param[in] check Subgroup check applied to the decoded points.
+                    template<typename TIter>
+                    static nil::marshalling::status_type
+                        process(std::vector<group_value_type> &points, TIter iter, std::size_t count,
+                                subgroup_check_mode check = subgroup_check_mode::batched) {
+                        std::vector<nil::marshalling::status_type> statuses(count,
+                                                                            nil::marshalling::status_type::success);
+                        points.resize(count);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+                        for (std::size_t i = 0; i < count; ++i) {
+                            TIter point_iter = iter;
+                            std::advance(point_iter, i * params_type::length());
+                            statuses[i] = decompress(points[i], point_iter);
+                            if (statuses[i] == nil::marshalling::status_type::success &&
+                                check == subgroup_check_mode::individual &&
+                                !algebra::curves::detail::subgroup_check(points[i])) {
+                                statuses[i] = nil::marshalling::status_type::invalid_msg_data;
+                            }
+                        }
+
+                        auto failed = std::find_if(statuses.begin(), statuses.end(), [](const auto &status) {
+                            return status != nil::marshalling::status_type::success;
+                        });
+                        if (failed != statuses.end()) {
+                            return *failed;
+                        }
+
+                        if (check == subgroup_check_mode::batched &&
+                            !algebra::curves::detail::batch_subgroup_check(points.begin(), points.end())) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        return nil::marshalling::status_type::success;
+                    }
+
+                private:
+                    template<typename TIter>
+                    static nil::marshalling::status_type decompress(group_value_type &point, TIter iter) {
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
+
+                        constexpr static const std::size_t arity = field_type::arity;
+                        constexpr static const std::size_t sizeof_field_element = params_type::bit_length() / arity;
+                        constexpr static const std::size_t units_bits = 8;
+                        constexpr static const std::size_t chunk_bits = sizeof(chunk_type) * units_bits;
+                        constexpr static const std::size_t sizeof_field_element_chunks_count =
+                            (sizeof_field_element / chunk_bits) + ((sizeof_field_element % chunk_bits) ? 1 : 0);
+
+                        const chunk_type m_unit = *iter;
+                        const bool infinity = m_unit & flags_type::I_bit;
+                        const bool sign = m_unit & flags_type::S_bit;
+                        if ((m_unit & flags_type::C_bit) != flags_type::C_bit || (infinity && sign)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        // the highest coefficient goes first, the flag bits are dropped by read_data
+                        std::array<integral_type, arity> x;
+                        for (std::size_t j = 0; j < arity; ++j) {
+                            TIter read_iter = iter;
+                            std::advance(read_iter, j * sizeof_field_element_chunks_count);
+                            x[arity - 1 - j] =
+                                read_data<sizeof_field_element, integral_type, endianness>(read_iter);
+                            if (x[arity - 1 - j] >= group_type::curve_type::base_field_type::modulus) {
+                                return nil::marshalling::status_type::invalid_msg_data;
+                            }
+                        }
+
+                        if (infinity) {
+                            if (std::any_of(x.begin(), x.end(), [](const integral_type &c) { return !c.is_zero(); })) {
+                                return nil::marshalling::status_type::invalid_msg_data;
+                            }
+                            point = group_value_type();    // point at infinity
+                            return nil::marshalling::status_type::success;
+                        }
+
+                        field_value_type x_mod;
+                        if constexpr (arity == 1) {
+                            x_mod = field_value_type(x[0]);
+                        } else {
+                            x_mod = field_value_type(x[0], x[1]);
+                        }
+                        const field_value_type y2_mod =
+                            x_mod.squared() * x_mod + field_value_type(group_type::params_type::b);
+                        field_value_type y_mod;
+                        if (!detail::checked_sqrt(y2_mod, y_mod)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        if (detail::sign_gf_p<field_type>(y_mod) != sign) {
+                            y_mod = -y_mod;
+                        }
+                        point = group_value_type(x_mod, y_mod, field_value_type::one());
+                        return nil::marshalling::status_type::success;
+                    }
+                };
+            }    // namespace processing
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_PROCESSING_CURVE_ELEMENT_BATCH_HPP
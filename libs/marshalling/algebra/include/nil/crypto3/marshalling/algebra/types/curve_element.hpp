@@ -38,6 +38,7 @@
 #include <nil/marshalling/types/tag.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 
+#include <nil/crypto3/marshalling/algebra/processing/curve_element_batch.hpp>
 #include <nil/crypto3/marshalling/algebra/types/detail/curve_element/basic_type.hpp>
 #include <nil/crypto3/marshalling/algebra/inference.hpp>
 #include <nil/crypto3/marshalling/algebra/type_traits.hpp>
@@ -402,6 +403,45 @@ namespace nil {
                     }
                     return result;
                 }
+
+                /// @brief Reads the serialized form of fill_curve_element_vector result straight into group
+                ///     elements, decompressing the points in parallel with curve_element_batch_reader.
+                /// @details Reading the array_list itself decodes the points one by one and does not check them.
+                /// @param[out] result Decoded points.
+                /// @param[in, out] iter Iterator to read the data, advanced on success.
+                /// @param[in] size Number of bytes available for reading.
+                /// @param[in] check Subgroup check applied to the decoded points.
+                /// @return Status of read operation.
+                template<typename CurveGroupType, typename Endianness, typename TIter>
+                nil::marshalling::status_type read_curve_element_vector(
+                    std::vector<typename CurveGroupType::value_type> &result, TIter &iter, std::size_t size,
+                    processing::subgroup_check_mode check = processing::subgroup_check_mode::batched) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using size_type = nil::marshalling::types::integral<TTypeBase, std::size_t>;
+                    using curve_element_type = curve_element<TTypeBase, CurveGroupType>;
+                    using reader_type =
+                        processing::curve_element_batch_reader<typename TTypeBase::endian_type, CurveGroupType>;
+
+                    TIter read_iter = iter;
+                    size_type count;
+                    nil::marshalling::status_type status = count.read(read_iter, size);
+                    if (status != nil::marshalling::status_type::success) {
+                        return status;
+                    }
+                    size -= count.length();
+                    if (count.value() > size / curve_element_type::length()) {
+                        return nil::marshalling::status_type::not_enough_data;
+                    }
+
+                    status = reader_type::process(result, read_iter, count.value(), check);
+                    if (status != nil::marshalling::status_type::success) {
+                        return status;
+                    }
+                    std::advance(read_iter, count.value() * curve_element_type::length());
+                    iter = read_iter;
+                    return status;
+                }
             }    // namespace types
         }        // namespace marshalling
     }            // namespace crypto3
@@ -0,0 +1,366 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MARSHALLING_RAW_ELEMENT_CONTAINER_HPP
+#define CRYPTO3_MARSHALLING_RAW_ELEMENT_CONTAINER_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/range/iterator_range.hpp>
+
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/types/integral.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+
+#include <nil/crypto3/algebra/batch_affine.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/fast_curve_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                /*
+                 * Raw element container: field elements and affine curve points stored exactly as they are laid
+                 * out in memory (Montgomery form, native limb order), so that a mapped file can be used as an
+                 * array of elements without any parsing and all the processes mapping it share the same pages.
+                 *
+                 * Layout, every part starts at a multiple of raw_container_alignment:
+                 *   raw_container_header
+                 *   for every section: raw_section_header, elements, zero padding
+                 *
+                 * The format is not portable between targets with a different limb size or endianness, or between
+                 * builds with a different element layout. Every section stores a fingerprint of its element layout,
+                 * which is checked when the section is accessed.
+                 */
+                constexpr std::size_t raw_container_alignment = 64;
+                constexpr std::uint32_t raw_container_version = 1;
+                constexpr std::array<char, 8> raw_container_magic = {'C', 'R', '3', 'R', 'A', 'W', 'E', 'L'};
+
+                struct alignas(raw_container_alignment) raw_container_header {
+                    std::array<char, 8> magic;
+                    std::uint32_t version;
+                    std::uint32_t header_size;
+                    std::uint64_t sections_count;
+                    std::uint64_t file_size;
+                    std::uint64_t reserved[4];
+                };
+
+                struct alignas(raw_container_alignment) raw_section_header {
+                    std::uint64_t element_size;
+                    std::uint64_t elements_count;
+                    std::uint64_t layout_fingerprint;
+                    std::uint64_t checksum;
+                    std::uint64_t reserved[4];
+                };
+
+                static_assert(sizeof(raw_container_header) == raw_container_alignment, "unexpected header size");
+                static_assert(sizeof(raw_section_header) == raw_container_alignment, "unexpected header size");
+
+                namespace detail {
+                    inline std::size_t raw_container_padded_size(std::size_t size) {
+                        return (size + raw_container_alignment - 1) / raw_container_alignment *
+                               raw_container_alignment;
+                    }
+
+                    // FNV-1a over 64-bit words, it only guards against truncated or damaged files.
+                    inline std::uint64_t raw_container_checksum(const unsigned char *data, std::size_t size) {
+                        constexpr std::uint64_t prime = 0x100000001b3ULL;
+                        std::uint64_t result = 0xcbf29ce484222325ULL;
+                        std::size_t i = 0;
+                        for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+                            std::uint64_t word;
+                            std::memcpy(&word, data + i, sizeof(word));
+                            result = (result ^ word) * prime;
+                        }
+                        for (; i < size; ++i) {
+                            result = (result ^ data[i]) * prime;
+                        }
+                        return result;
+                    }
+
+                    /*
+                     * Elements are only stored raw if all their state is in their bytes. This holds for the field
+                     * elements with compile-time modular params and the affine points built from them, which have
+                     * user-provided copy operations but no pointers or virtual functions.
+                     */
+                    template<typename ValueType>
+                    struct is_raw_storable
+                        : std::integral_constant<bool, std::is_standard_layout<ValueType>::value &&
+                                                           std::is_trivially_destructible<ValueType>::value> { };
+                }    // namespace detail
+
+                /*!
+                 * @brief Fingerprint of the in-memory layout of ValueType: its size and the bytes of
+                 * ValueType::one(), which capture the modulus, the Montgomery form, the limb size and the
+                 * endianness of the build.
+                 */
+                template<typename ValueType>
+                std::uint64_t raw_layout_fingerprint() {
+                    static_assert(detail::is_raw_storable<ValueType>::value, "ValueType can't be stored raw");
+                    // The elements may have padding bytes, they are zeroed first to keep the fingerprint stable.
+                    alignas(ValueType) unsigned char one[sizeof(ValueType)] = {};
+                    new (one) ValueType(ValueType::one());
+                    std::uint64_t result = detail::raw_container_checksum(one, sizeof(one));
+                    return (result ^ sizeof(ValueType)) * 0x100000001b3ULL;
+                }
+
+                /*!
+                 * @brief Collects sections of elements and writes them as a raw element container.
+                 * The elements are copied into the writer, the sources may be released after add().
+                 */
+                class raw_container_writer {
+                public:
+                    template<typename ValueType>
+                    std::size_t add(const ValueType *first, std::size_t count) {
+                        static_assert(detail::is_raw_storable<ValueType>::value, "ValueType can't be stored raw");
+
+                        section_type section;
+                        section.header = raw_section_header();
+                        section.header.element_size = sizeof(ValueType);
+                        section.header.elements_count = count;
+                        section.header.layout_fingerprint = raw_layout_fingerprint<ValueType>();
+                        section.data.resize(count * sizeof(ValueType));
+                        if (count != 0) {
+                            std::memcpy(section.data.data(), static_cast<const void *>(first), section.data.size());
+                        }
+                        section.header.checksum =
+                            detail::raw_container_checksum(section.data.data(), section.data.size());
+                        _sections.emplace_back(std::move(section));
+                        return _sections.size() - 1;
+                    }
+
+                    template<typename ValueType>
+                    std::size_t add(const std::vector<ValueType> &elements) {
+                        return add(elements.data(), elements.size());
+                    }
+
+                    std::size_t size() const {
+                        std::size_t result = sizeof(raw_container_header);
+                        for (const auto &section : _sections) {
+                            result += sizeof(raw_section_header) + detail::raw_container_padded_size(section.data.size());
+                        }
+                        return result;
+                    }
+
+                    nil::marshalling::status_type write(std::ostream &os) const {
+                        raw_container_header header = raw_container_header();
+                        header.magic = raw_container_magic;
+                        header.version = raw_container_version;
+                        header.header_size = sizeof(raw_container_header);
+                        header.sections_count = _sections.size();
+                        header.file_size = size();
+                        os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+                        const std::array<char, raw_container_alignment> padding = {};
+                        for (const auto &section : _sections) {
+                            os.write(reinterpret_cast<const char *>(&section.header), sizeof(section.header));
+                            os.write(reinterpret_cast<const char *>(section.data.data()), section.data.size());
+                            os.write(padding.data(),
+                                     detail::raw_container_padded_size(section.data.size()) - section.data.size());
+                        }
+                        return os.good() ? nil::marshalling::status_type::success :
+                                           nil::marshalling::status_type::buffer_overflow;
+                    }
+
+                private:
+                    struct section_type {
+                        raw_section_header header;
+                        std::vector<unsigned char> data;
+                    };
+
+                    std::vector<section_type> _sections;
+                };
+
+                /*!
+                 * @brief Read-only view of a raw element container in memory. Reading only checks the headers
+                 * and, optionally, the checksums; sections are returned as ranges pointing into the buffer, which
+                 * must outlive the view and be aligned to raw_container_alignment.
+                 */
+                class raw_container_view {
+                public:
+                    raw_container_view() = default;
+
+                    nil::marshalling::status_type read(const unsigned char *data, std::size_t size,
+                                                       bool verify_checksums = true) {
+                        _sections.clear();
+
+                        if (size < sizeof(raw_container_header)) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+                        if (reinterpret_cast<std::uintptr_t>(data) % raw_container_alignment != 0) {
+                            return nil::marshalling::status_type::not_supported;
+                        }
+                        const raw_container_header &header = *reinterpret_cast<const raw_container_header *>(data);
+                        if (header.magic != raw_container_magic || header.version != raw_container_version ||
+                            header.header_size != sizeof(raw_container_header)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+                        if (header.file_size > size) {
+                            return nil::marshalling::status_type::not_enough_data;
+                        }
+                        if (header.file_size < sizeof(raw_container_header)) {
+                            return nil::marshalling::status_type::invalid_msg_data;
+                        }
+
+                        std::size_t offset = sizeof(raw_container_header);
+                        for (std::size_t i = 0; i < header.sections_count; ++i) {
+                            if (header.file_size - offset < sizeof(raw_section_header)) {
+                                return nil::marshalling::status_type::not_enough_data;
+                            }
+                            const raw_section_header &section =
+                                *reinterpret_cast<const raw_section_header *>(data + offset);
+                            offset += sizeof(raw_section_header);
+
+                            if (section.element_size != 0 &&
+                                section.elements_count > (header.file_size - offset) / section.element_size) {
+                                return nil::marshalling::status_type::not_enough_data;
+                            }
+                            const std::size_t data_size = section.elements_count * section.element_size;
+                            const std::size_t padded_size = detail::raw_container_padded_size(data_size);
+                            // The padding must be in the file too, otherwise the next header would be read past it.
+                            if (padded_size > header.file_size - offset) {
+                                return nil::marshalling::status_type::not_enough_data;
+                            }
+                            if (verify_checksums &&
+                                detail::raw_container_checksum(data + offset, data_size) != section.checksum) {
+                                return nil::marshalling::status_type::invalid_msg_data;
+                            }
+                            _sections.push_back(&section);
+                            offset += padded_size;
+                        }
+
+                        return nil::marshalling::status_type::success;
+                    }
+
+                    std::size_t sections_count() const {
+                        return _sections.size();
+                    }
+
+                    /*!
+                     * @brief Elements of the section, fails with invalid_msg_data if they were written
+                     * with another element type or element layout.
+                     */
+                    template<typename ValueType>
+                    boost::iterator_range<const ValueType *> section(std::size_t index,
+                                                                     nil::marshalling::status_type &status) const {
+                        static_assert(detail::is_raw_storable<ValueType>::value, "ValueType can't be stored raw");
+
+                        if (index >= _sections.size()) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return {};
+                        }
+                        const raw_section_header &header = *_sections[index];
+                        if (header.element_size != sizeof(ValueType) ||
+                            header.layout_fingerprint != raw_layout_fingerprint<ValueType>()) {
+                            status = nil::marshalling::status_type::invalid_msg_data;
+                            return {};
+                        }
+                        status = nil::marshalling::status_type::success;
+                        const ValueType *first = reinterpret_cast<const ValueType *>(&header + 1);
+                        return boost::make_iterator_range(first, first + header.elements_count);
+                    }
+
+                private:
+                    std::vector<const raw_section_header *> _sections;
+                };
+
+                /*!
+                 * @brief Raw element container mapped read-only from a file. The pages are shared with every
+                 * other process mapping the same file and are only loaded when touched, unless the checksums
+                 * are verified on opening.
+                 */
+                class mapped_raw_container : public raw_container_view {
+                public:
+                    mapped_raw_container(const std::string &path, nil::marshalling::status_type &status,
+                                         bool verify_checksums = true) {
+                        try {
+                            _file = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+                            _region = boost::interprocess::mapped_region(_file, boost::interprocess::read_only);
+                        } catch (const boost::interprocess::interprocess_exception &) {
+                            status = nil::marshalling::status_type::not_enough_data;
+                            return;
+                        }
+                        status = read(static_cast<const unsigned char *>(_region.get_address()), _region.get_size(),
+                                      verify_checksums);
+                    }
+
+                private:
+                    boost::interprocess::file_mapping _file;
+                    boost::interprocess::mapped_region _region;
+                };
+
+                /*!
+                 * @brief Affine points for the raw container from points in jacobian or projective coordinates,
+                 * with a single field inversion.
+                 */
+                template<typename CurveElementType>
+                std::vector<decltype(std::declval<CurveElementType>().to_affine())>
+                    make_raw_curve_element_vector(const std::vector<CurveElementType> &curve_elem_vector) {
+                    return algebra::batch_to_affine(curve_elem_vector);
+                }
+
+                /*!
+                 * @brief Affine points for the raw container from the fast_curve_element format, without going
+                 * through the group value type.
+                 */
+                template<typename CurveGroupType, typename Endianness>
+                std::vector<decltype(std::declval<typename CurveGroupType::value_type>().to_affine())>
+                    make_raw_curve_element_vector(
+                        const nil::marshalling::types::array_list<
+                            nil::marshalling::field_type<Endianness>,
+                            fast_curve_element<nil::marshalling::field_type<Endianness>, CurveGroupType>,
+                            nil::marshalling::option::sequence_size_field_prefix<nil::marshalling::types::integral<
+                                nil::marshalling::field_type<Endianness>, std::size_t>>> &curve_elem_vector) {
+
+                    typedef decltype(std::declval<typename CurveGroupType::value_type>().to_affine())
+                        affine_value_type;
+
+                    std::vector<affine_value_type> result;
+                    result.reserve(curve_elem_vector.value().size());
+                    for (const auto &element : curve_elem_vector.value()) {
+                        if (std::get<2>(element.value()).value()) {
+                            result.emplace_back(affine_value_type::zero());
+                        } else {
+                            result.emplace_back(std::get<0>(element.value()).value(),
+                                                std::get<1>(element.value()).value());
+                        }
+                    }
+                    return result;
+                }
+            }    // namespace types
+        }        // namespace marshalling
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_RAW_ELEMENT_CONTAINER_HPP
@@ -41,6 +41,8 @@
 
 #include <nil/crypto3/algebra/random_element.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 
 #include <nil/marshalling/algorithms/pack.hpp>
 
@@ -88,6 +90,59 @@ void test_curve_element_non_fixed_size_container() {
     }
 }
 
+template<typename CurveGroup>
+std::vector<unsigned char> write_curve_element_vector(const std::vector<typename CurveGroup::value_type> &points) {
+    using namespace nil::crypto3::marshalling;
+
+    auto filled = types::fill_curve_element_vector<CurveGroup, nil::marshalling::option::big_endian>(points);
+    std::vector<unsigned char> blob(filled.length());
+    auto write_iter = blob.begin();
+    BOOST_CHECK(filled.write(write_iter, blob.size()) == nil::marshalling::status_type::success);
+    return blob;
+}
+
+template<typename CurveGroup>
+nil::marshalling::status_type
+    batch_read_curve_element_vector(const std::vector<unsigned char> &blob,
+                                    std::vector<typename CurveGroup::value_type> &points,
+                                    nil::crypto3::marshalling::processing::subgroup_check_mode check) {
+    using namespace nil::crypto3::marshalling;
+
+    auto read_iter = blob.cbegin();
+    nil::marshalling::status_type status =
+        types::read_curve_element_vector<CurveGroup, nil::marshalling::option::big_endian>(points, read_iter,
+                                                                                           blob.size(), check);
+    if (status == nil::marshalling::status_type::success) {
+        BOOST_CHECK(read_iter == blob.cend());
+    }
+    return status;
+}
+
+template<typename CurveGroup>
+void test_curve_element_batch_reader(std::size_t size) {
+    using nil::crypto3::marshalling::processing::subgroup_check_mode;
+
+    std::vector<typename CurveGroup::value_type> points;
+    for (std::size_t i = 0; i < size; i++) {
+        points.push_back(nil::crypto3::algebra::random_element<CurveGroup>());
+    }
+    points.push_back(CurveGroup::value_type::zero());
+    const std::vector<unsigned char> blob = write_curve_element_vector<CurveGroup>(points);
+
+    for (subgroup_check_mode check :
+         {subgroup_check_mode::none, subgroup_check_mode::individual, subgroup_check_mode::batched}) {
+        std::vector<typename CurveGroup::value_type> result;
+        BOOST_CHECK(batch_read_curve_element_vector<CurveGroup>(blob, result, check) ==
+                    nil::marshalling::status_type::success);
+        BOOST_CHECK(result == points);
+    }
+
+    std::vector<typename CurveGroup::value_type> result;
+    const std::vector<unsigned char> truncated(blob.begin(), blob.end() - 1);
+    BOOST_CHECK(batch_read_curve_element_vector<CurveGroup>(truncated, result, subgroup_check_mode::none) ==
+                nil::marshalling::status_type::not_enough_data);
+}
+
 BOOST_AUTO_TEST_SUITE(curve_element_non_fixed_size_container_test_suite)
 
 BOOST_AUTO_TEST_CASE(curve_element_non_fixed_size_container_bls12_381_g1) {
@@ -106,4 +161,62 @@ BOOST_AUTO_TEST_CASE(curve_element_non_fixed_size_container_bls12_381_g2) {
     std::cout << "BLS12-381 g2 group non fixed size container test finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(curve_element_batch_reader_bls12_381_g1) {
+    test_curve_element_batch_reader<nil::crypto3::algebra::curves::bls12<381>::g1_type<>>(200);
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reader_bls12_381_g2) {
+    test_curve_element_batch_reader<nil::crypto3::algebra::curves::bls12<381>::g2_type<>>(130);
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reader_bn254) {
+    test_curve_element_batch_reader<nil::crypto3::algebra::curves::alt_bn128<254>::g1_type<>>(25);
+    test_curve_element_batch_reader<nil::crypto3::algebra::curves::alt_bn128<254>::g2_type<>>(25);
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reader_invalid_points) {
+    using nil::crypto3::marshalling::processing::subgroup_check_mode;
+    typedef nil::crypto3::algebra::curves::bls12<381>::g1_type<> group_type;
+    typedef group_type::value_type group_value_type;
+    typedef group_type::field_type::value_type field_value_type;
+
+    // Points on the curve outside of the subgroup, and an x with no point on the curve
+    group_value_type outside;
+    field_value_type not_on_curve;
+    bool outside_found = false, not_on_curve_found = false;
+    for (field_value_type x = field_value_type::one(); !outside_found || !not_on_curve_found; ++x) {
+        field_value_type y2 = x.squared() * x + field_value_type(4u);
+        if (!y2.is_square()) {
+            not_on_curve = x;
+            not_on_curve_found = true;
+        } else if (!outside_found) {
+            outside = group_value_type(x, y2.sqrt(), field_value_type::one());
+            outside_found = !nil::crypto3::algebra::curves::detail::subgroup_check(outside);
+        }
+    }
+
+    std::vector<group_value_type> points;
+    for (std::size_t i = 0; i < 200; i++) {
+        points.push_back(nil::crypto3::algebra::random_element<group_type>());
+    }
+    points[100] = outside;
+    std::vector<unsigned char> blob = write_curve_element_vector<group_type>(points);
+
+    std::vector<group_value_type> result;
+    BOOST_CHECK(batch_read_curve_element_vector<group_type>(blob, result, subgroup_check_mode::none) ==
+                nil::marshalling::status_type::success);
+    BOOST_CHECK(batch_read_curve_element_vector<group_type>(blob, result, subgroup_check_mode::individual) ==
+                nil::marshalling::status_type::invalid_msg_data);
+    BOOST_CHECK(batch_read_curve_element_vector<group_type>(blob, result, subgroup_check_mode::batched) ==
+                nil::marshalling::status_type::invalid_msg_data);
+
+    // Overwrite x of the first point, after the size prefix
+    auto x_iter = blob.begin() + sizeof(std::size_t);
+    nil::crypto3::marshalling::processing::write_data<381, nil::marshalling::endian::big_endian>(
+        static_cast<group_type::field_type::integral_type>(not_on_curve.data), x_iter);
+    *x_iter |= 0x80;
+    BOOST_CHECK(batch_read_curve_element_vector<group_type>(blob, result, subgroup_check_mode::none) ==
+                nil::marshalling::status_type::invalid_msg_data);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
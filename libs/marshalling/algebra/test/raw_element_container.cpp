@@ -0,0 +1,233 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE crypto3_marshalling_raw_element_container_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/endianness.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/raw_element_container.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::marshalling;
+
+std::string raw_container_test_path(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / ("crypto3_" + name + ".raw")).string();
+}
+
+template<typename GroupType>
+std::vector<typename GroupType::value_type> random_points(std::size_t size) {
+    std::vector<typename GroupType::value_type> result;
+    for (std::size_t i = 0; i < size; ++i) {
+        result.push_back(algebra::random_element<GroupType>());
+    }
+    result.push_back(GroupType::value_type::zero());
+    return result;
+}
+
+template<typename PointsRange, typename CurveElementType>
+bool equal_points(const PointsRange &affine_points, const std::vector<CurveElementType> &points) {
+    if (std::size_t(affine_points.size()) != points.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        if (affine_points[i] != points[i].to_affine()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_SUITE(raw_element_container_test_suite)
+
+BOOST_AUTO_TEST_CASE(raw_element_container_round_trip) {
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef curve_type::g1_type<> g1_type;
+    typedef curve_type::g2_type<> g2_type;
+    typedef curve_type::scalar_field_type scalar_field_type;
+
+    auto g1_points = random_points<g1_type>(17);
+    auto g2_points = random_points<g2_type>(5);
+    std::vector<scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < 9; ++i) {
+        scalars.push_back(algebra::random_element<scalar_field_type>());
+    }
+
+    auto g1_affine = types::make_raw_curve_element_vector(g1_points);
+    auto g2_affine = types::make_raw_curve_element_vector(g2_points);
+
+    types::raw_container_writer writer;
+    BOOST_CHECK_EQUAL(writer.add(g1_affine), 0u);
+    BOOST_CHECK_EQUAL(writer.add(g2_affine), 1u);
+    BOOST_CHECK_EQUAL(writer.add(scalars), 2u);
+
+    const std::string path = raw_container_test_path("round_trip");
+    {
+        std::ofstream out(path, std::ios::binary);
+        BOOST_CHECK(writer.write(out) == nil::marshalling::status_type::success);
+    }
+    BOOST_CHECK_EQUAL(std::filesystem::file_size(path), writer.size());
+
+    nil::marshalling::status_type status;
+    types::mapped_raw_container container(path, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK_EQUAL(container.sections_count(), 3u);
+
+    auto g1_section = container.section<decltype(g1_affine)::value_type>(0, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(equal_points(g1_section, g1_points));
+
+    auto g2_section = container.section<decltype(g2_affine)::value_type>(1, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(equal_points(g2_section, g2_points));
+
+    auto scalars_section = container.section<scalar_field_type::value_type>(2, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    BOOST_CHECK(std::equal(scalars_section.begin(), scalars_section.end(), scalars.begin(), scalars.end()));
+
+    // Elements of another layout are refused.
+    container.section<curve_type::base_field_type::value_type>(2, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    container.section<decltype(g1_affine)::value_type>(3, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(raw_element_container_damaged) {
+    typedef algebra::curves::alt_bn128<254> curve_type;
+    typedef curve_type::g1_type<> g1_type;
+
+    types::raw_container_writer writer;
+    writer.add(types::make_raw_curve_element_vector(random_points<g1_type>(8)));
+
+    const std::string path = raw_container_test_path("damaged");
+    {
+        std::ofstream out(path, std::ios::binary);
+        writer.write(out);
+    }
+    {
+        // Flip a byte of the first point.
+        const std::size_t position = 2 * types::raw_container_alignment + 3;
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(position);
+        char byte = char(file.get());
+        file.seekp(position);
+        file.put(char(~byte));
+    }
+
+    nil::marshalling::status_type status;
+    {
+        types::mapped_raw_container container(path, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::invalid_msg_data);
+    }
+    {
+        types::mapped_raw_container container(path, status, false);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+    }
+
+    std::filesystem::resize_file(path, writer.size() - types::raw_container_alignment);
+    {
+        types::mapped_raw_container container(path, status, false);
+        BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+    }
+
+    std::filesystem::remove(path);
+    types::mapped_raw_container missing(path, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::not_enough_data);
+}
+
+BOOST_AUTO_TEST_CASE(raw_element_container_truncated_section) {
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef curve_type::scalar_field_type scalar_field_type;
+    typedef scalar_field_type::value_type value_type;
+
+    // One element leaves padding after the section, which is what is cut off below.
+    BOOST_REQUIRE(sizeof(value_type) % types::raw_container_alignment != 0);
+
+    types::raw_container_writer writer;
+    writer.add(std::vector<value_type> {algebra::random_element<scalar_field_type>()});
+    writer.add(std::vector<value_type> {algebra::random_element<scalar_field_type>()});
+
+    std::ostringstream out;
+    BOOST_CHECK(writer.write(out) == nil::marshalling::status_type::success);
+    const std::string bytes = out.str();
+
+    // Section headers are aligned to raw_container_alignment, so is a buffer of them.
+    std::vector<types::raw_section_header> buffer(bytes.size() / sizeof(types::raw_section_header));
+    unsigned char *data = reinterpret_cast<unsigned char *>(buffer.data());
+    std::memcpy(data, bytes.data(), bytes.size());
+    types::raw_container_header &header = *reinterpret_cast<types::raw_container_header *>(data);
+    types::raw_section_header &first_section =
+        *reinterpret_cast<types::raw_section_header *>(data + sizeof(types::raw_container_header));
+
+    types::raw_container_view view;
+    BOOST_CHECK(view.read(data, bytes.size()) == nil::marshalling::status_type::success);
+    BOOST_CHECK_EQUAL(view.sections_count(), 2u);
+
+    // The file ends after the elements of the first section, before its padding.
+    header.file_size = sizeof(types::raw_container_header) + sizeof(types::raw_section_header) + sizeof(value_type);
+    BOOST_CHECK(view.read(data, bytes.size(), false) == nil::marshalling::status_type::not_enough_data);
+    header.sections_count = 1;
+    BOOST_CHECK(view.read(data, bytes.size(), false) == nil::marshalling::status_type::not_enough_data);
+
+    // A section larger than the file.
+    header.file_size = bytes.size();
+    header.sections_count = 2;
+    first_section.elements_count = bytes.size();
+    BOOST_CHECK(view.read(data, bytes.size(), false) == nil::marshalling::status_type::not_enough_data);
+
+    // A file smaller than its own header.
+    first_section.elements_count = 1;
+    header.file_size = sizeof(types::raw_container_header) / 2;
+    BOOST_CHECK(view.read(data, bytes.size(), false) == nil::marshalling::status_type::invalid_msg_data);
+    BOOST_CHECK_EQUAL(view.sections_count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(raw_element_container_from_fast_curve_element) {
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef curve_type::g1_type<> g1_type;
+    typedef nil::marshalling::option::big_endian endianness;
+
+    auto points = random_points<g1_type>(11);
+    auto filled = types::fill_fast_curve_element_vector<g1_type, endianness>(points);
+    auto affine = types::make_raw_curve_element_vector<g1_type, endianness>(filled);
+
+    BOOST_CHECK(equal_points(affine, points));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_BARYCENTRIC_EVALUATION_HPP
+#define CRYPTO3_MATH_BARYCENTRIC_EVALUATION_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <nil/crypto3/algebra/batch_inversion.hpp>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * Number of contiguous chunks [0, size) is split into by parallel_chunks, one per worker.
+                 */
+                inline std::size_t parallel_chunks_amount(std::size_t size) {
+                    return size < parallel_threshold ? 1 : std::min(std::max<std::size_t>(worker_count(), 1), size);
+                }
+
+                /*
+                 * Calls func(chunk, begin, end) for every chunk of [0, size), the chunks run in parallel.
+                 */
+                template<typename Func>
+                void parallel_chunks(std::size_t size, Func &&func) {
+                    const std::size_t chunks_amount = parallel_chunks_amount(size);
+                    const std::size_t chunk_size = (size + chunks_amount - 1) / chunks_amount;
+                    parallel_for(
+                        0, chunks_amount,
+                        [&](std::size_t c) {
+                            const std::size_t begin = c * chunk_size;
+                            const std::size_t end = std::min(begin + chunk_size, size);
+                            if (begin < end) {
+                                func(c, begin, end);
+                            }
+                        },
+                        2);
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Evaluates many columns, given by their values on radix-2 domains in the same order as
+             * polynomial_dfs, at a few shared points.
+             *
+             * For a column v of size n and a point z, v(z) = sum_i w_i v_i with the barycentric weights
+             * w_i = (z^n - 1) / n * omega^i / (z - omega^i). The weights of every (size, point) pair are
+             * computed once, with one batch inversion per chunk of the domain, so every column costs a
+             * single dot product per point instead of an inverse FFT.
+             * If z lies in the domain, its weights select the matching value.
+             */
+            template<typename FieldType>
+            class barycentric_evaluator {
+            public:
+                typedef typename FieldType::value_type value_type;
+
+                /*!
+                 * @brief Precomputes the weights of columns of the given size at point, does nothing if they are
+                 * already there. Not thread safe, all the pairs should be added before evaluating in parallel.
+                 */
+                const std::vector<value_type> &add(std::size_t size, const value_type &point) {
+                    if (!detail::is_power_of_two(size)) {
+                        throw std::invalid_argument("barycentric_evaluator: expected column size to be a power of two");
+                    }
+                    auto &size_weights = _weights[size];
+                    auto it = size_weights.find(point);
+                    if (it == size_weights.end()) {
+                        it = size_weights.emplace(point, compute_weights(size, point)).first;
+                    }
+                    return it->second;
+                }
+
+                const std::vector<value_type> &weights(std::size_t size, const value_type &point) const {
+                    return _weights.at(size).at(point);
+                }
+
+                /*!
+                 * @brief Value at point of the column, its weights must have been added.
+                 * The dot product runs in parallel unless called from a parallel region.
+                 */
+                template<typename ColumnType>
+                value_type evaluate(const ColumnType &column, const value_type &point) const {
+                    const std::size_t n = std::distance(std::begin(column), std::end(column));
+                    const std::vector<value_type> &w = weights(n, point);
+                    const auto first = std::begin(column);
+
+                    std::vector<value_type> partial_sums(detail::parallel_chunks_amount(n), value_type::zero());
+                    detail::parallel_chunks(n, [&](std::size_t c, std::size_t begin, std::size_t end) {
+                        value_type sum = value_type::zero();
+                        auto it = first;
+                        std::advance(it, begin);
+                        for (std::size_t i = begin; i < end; ++i, ++it) {
+                            sum += w[i] * *it;
+                        }
+                        partial_sums[c] = sum;
+                    });
+
+                    value_type result = value_type::zero();
+                    for (const auto &sum : partial_sums) {
+                        result += sum;
+                    }
+                    return result;
+                }
+
+                /*!
+                 * @brief Returns sum_c theta^c * columns[c](point) for columns of one size, fused into a single pass
+                 * over the rows: every row is combined first and then weighted once.
+                 */
+                template<typename ColumnsRange>
+                value_type evaluate_combined(const ColumnsRange &columns, const value_type &theta,
+                                             const value_type &point) const {
+                    const std::size_t columns_amount = std::distance(std::begin(columns), std::end(columns));
+                    if (columns_amount == 0) {
+                        return value_type::zero();
+                    }
+                    const std::size_t n = std::distance(std::begin(*std::begin(columns)),
+                                                        std::end(*std::begin(columns)));
+
+                    for (const auto &column : columns) {
+                        if (std::size_t(std::distance(std::begin(column), std::end(column))) != n) {
+                            throw std::invalid_argument(
+                                "barycentric_evaluator: expected combined columns of the same size");
+                        }
+                    }
+
+                    std::vector<value_type> rows(n, value_type::zero());
+                    detail::parallel_chunks(n, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        for (std::size_t c = columns_amount; c > 0; --c) {
+                            auto it = std::begin(*(std::begin(columns) + (c - 1)));
+                            std::advance(it, begin);
+                            for (std::size_t i = begin; i < end; ++i, ++it) {
+                                rows[i] = rows[i] * theta + *it;
+                            }
+                        }
+                    });
+                    return evaluate(rows, point);
+                }
+
+            private:
+                static std::vector<value_type> compute_weights(std::size_t n, const value_type &point) {
+                    const value_type omega = unity_root<FieldType>(n);
+                    std::vector<value_type> w(n);
+
+                    const value_type vanishing = point.pow(n) - value_type::one();
+                    if (vanishing.is_zero()) {
+                        std::fill(w.begin(), w.end(), value_type::zero());
+                        value_type element = value_type::one();
+                        for (std::size_t i = 0; i < n; ++i, element *= omega) {
+                            if (element == point) {
+                                w[i] = value_type::one();
+                                break;
+                            }
+                        }
+                        return w;
+                    }
+
+                    const value_type scale = vanishing * value_type(n).inversed();
+                    detail::parallel_chunks(n, [&](std::size_t, std::size_t begin, std::size_t end) {
+                        std::vector<value_type> elements(end - begin);
+                        elements[0] = omega.pow(begin);
+                        for (std::size_t i = 1; i < elements.size(); ++i) {
+                            elements[i] = elements[i - 1] * omega;
+                        }
+                        auto denominators = boost::make_iterator_range(w.begin() + begin, w.begin() + end);
+                        for (std::size_t i = 0; i < elements.size(); ++i) {
+                            denominators[i] = point - elements[i];
+                        }
+                        algebra::batch_invert(denominators);
+                        for (std::size_t i = 0; i < elements.size(); ++i) {
+                            denominators[i] *= scale * elements[i];
+                        }
+                    });
+                    return w;
+                }
+
+                std::unordered_map<std::size_t, std::unordered_map<value_type, std::vector<value_type>>> _weights;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_BARYCENTRIC_EVALUATION_HPP
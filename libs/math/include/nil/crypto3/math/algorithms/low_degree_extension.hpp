@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_LOW_DEGREE_EXTENSION_HPP
+#define CRYPTO3_MATH_LOW_DEGREE_EXTENSION_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/range/iterator_range.hpp>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                template<typename FieldType, typename Range>
+                void low_degree_extension_fft(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
+                    if (a.size() >= fft_blocked_threshold) {
+                        basic_radix2_fft_cached_blocked<FieldType>(a, omega_cache);
+                    } else {
+                        basic_radix2_fft_cached<FieldType>(a, omega_cache);
+                    }
+                }
+
+                // Columns can also be passed as std::reference_wrapper to avoid copying them into a container.
+                template<typename ColumnType>
+                const ColumnType &low_degree_extension_column(const ColumnType &column) {
+                    return column;
+                }
+
+                template<typename ColumnType>
+                const ColumnType &low_degree_extension_column(const std::reference_wrapper<ColumnType> &column) {
+                    return column.get();
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Extends a batch of columns to a larger domain in one pass.
+             *
+             * Column c is given by its values on the radix-2 domain of size columns[c].size(), in the same
+             * order as polynomial_dfs. Its values on the coset shift * H, where H is the radix-2 domain of size
+             * extended_size, are written to matrix[c * extended_size, (c + 1) * extended_size).
+             * With shift equal to one this is what polynomial_dfs::resize(extended_size) computes.
+             *
+             * The twiddle tables are computed once for every distinct size. The transforms run in place
+             * in matrix, which is only reallocated when it is too small. If there are at least as many
+             * columns as workers, the columns are extended in parallel, otherwise every fft is parallel.
+             */
+            template<typename FieldType, typename ColumnsRange>
+            void low_degree_extension(const ColumnsRange &columns, std::size_t extended_size,
+                                      std::vector<typename FieldType::value_type> &matrix,
+                                      const typename FieldType::value_type &shift = FieldType::value_type::one()) {
+                typedef typename FieldType::value_type value_type;
+
+                if (!detail::is_power_of_two(extended_size)) {
+                    throw std::invalid_argument("low_degree_extension: expected extended_size to be a power of two");
+                }
+
+                const std::size_t columns_amount = std::distance(std::begin(columns), std::end(columns));
+                matrix.resize(columns_amount * extended_size);
+
+                // Per column size: twiddles of the inverse transform and the factors shift^j / n
+                // that turn coefficients of p(x) into coefficients of p(shift * x), divided by n.
+                struct size_tables {
+                    std::vector<value_type> inverse_omega_cache;
+                    std::vector<value_type> factors;
+                };
+                std::unordered_map<std::size_t, size_tables> tables;
+                for (const auto &element : columns) {
+                    const std::size_t n = detail::low_degree_extension_column(element).size();
+                    if (!detail::is_power_of_two(n) || n > extended_size) {
+                        throw std::invalid_argument(
+                            "low_degree_extension: expected column sizes to be powers of two not above extended_size");
+                    }
+                    if (tables.find(n) != tables.end()) {
+                        continue;
+                    }
+                    size_tables &t = tables[n];
+                    detail::create_fft_cache<FieldType>(n, unity_root<FieldType>(n).inversed(), t.inverse_omega_cache);
+                    detail::create_fft_cache<FieldType>(n, shift, t.factors);
+                    const value_type n_inversed = value_type(n).inversed();
+                    for (auto &factor : t.factors) {
+                        factor *= n_inversed;
+                    }
+                }
+
+                std::vector<value_type> omega_cache;
+                detail::create_fft_cache<FieldType>(extended_size, unity_root<FieldType>(extended_size), omega_cache);
+
+                const bool is_subgroup = (shift == value_type::one());
+                parallel_for(
+                    0, columns_amount,
+                    [&](std::size_t c) {
+                        const auto &column = detail::low_degree_extension_column(*(std::begin(columns) + c));
+                        const std::size_t n = column.size();
+                        value_type *first = matrix.data() + c * extended_size;
+
+                        std::copy(std::begin(column), std::end(column), first);
+                        if (n == extended_size && is_subgroup) {
+                            return;
+                        }
+
+                        const size_tables &t = tables.at(n);
+                        auto coefficients = boost::make_iterator_range(first, first + n);
+                        detail::low_degree_extension_fft<FieldType>(coefficients, t.inverse_omega_cache);
+                        for (std::size_t j = 0; j < n; ++j) {
+                            first[j] *= t.factors[j];
+                        }
+                        std::fill(first + n, first + extended_size, value_type::zero());
+
+                        auto values = boost::make_iterator_range(first, first + extended_size);
+                        detail::low_degree_extension_fft<FieldType>(values, omega_cache);
+                    },
+                    std::max<std::size_t>(2, worker_count()));
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_LOW_DEGREE_EXTENSION_HPP
@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_HPP
 #define CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_HPP
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -50,12 +52,25 @@ namespace nil {
                 typedef ValueType value_type;
                 typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
                 std::shared_ptr<cache_type> fft_cache;
+                mutable std::mutex fft_cache_mutex;
 
-                void create_fft_cache() {
-                    fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
-                                                             std::vector<field_value_type>());
-                    detail::create_fft_cache<FieldType>(this->m, omega, fft_cache->first);
-                    detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
+                // The cache is built on first use. The same domain may be shared by threads running
+                // ffts concurrently, the first one builds it and the others wait for it.
+                std::shared_ptr<cache_type> get_fft_cache() {
+                    std::lock_guard<std::mutex> lock(fft_cache_mutex);
+                    if (!fft_cache) {
+                        fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
+                                                                 std::vector<field_value_type>());
+                        detail::create_fft_cache<FieldType>(this->m, omega, fft_cache->first);
+                        detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
+                    }
+                    return fft_cache;
+                }
+
+                // The cache is never modified once built, copies of the domain share it.
+                std::shared_ptr<cache_type> built_fft_cache() const {
+                    std::lock_guard<std::mutex> lock(fft_cache_mutex);
+                    return fft_cache;
                 }
 
             public:
@@ -77,6 +92,22 @@ namespace nil {
                     }
                 }
 
+                basic_radix2_domain(const basic_radix2_domain &other) :
+                        evaluation_domain<FieldType, ValueType>(other), fft_cache(other.built_fft_cache()),
+                        omega(other.omega) {
+                }
+
+                basic_radix2_domain &operator=(const basic_radix2_domain &other) {
+                    if (this != &other) {
+                        std::shared_ptr<cache_type> cache = other.built_fft_cache();
+                        evaluation_domain<FieldType, ValueType>::operator=(other);
+                        omega = other.omega;
+                        std::lock_guard<std::mutex> lock(fft_cache_mutex);
+                        fft_cache = std::move(cache);
+                    }
+                    return *this;
+                }
+
                 void fft(std::vector<value_type> &a) override {
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
@@ -86,10 +117,12 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
+                    std::shared_ptr<cache_type> cache = get_fft_cache();
+                    if (this->m >= detail::fft_blocked_threshold) {
+                        detail::basic_radix2_fft_cached_blocked<FieldType>(a, cache->first);
+                    } else {
+                        detail::basic_radix2_fft_cached<FieldType>(a, cache->first);
                     }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
@@ -101,15 +134,15 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
+                    std::shared_ptr<cache_type> cache = get_fft_cache();
+                    if (this->m >= detail::fft_blocked_threshold) {
+                        detail::basic_radix2_fft_cached_blocked<FieldType>(a, cache->second);
+                    } else {
+                        detail::basic_radix2_fft_cached<FieldType>(a, cache->second);
                     }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
 
                     const field_value_type sconst = field_value_type(a.size()).inversed();
-                    for (std::size_t i = 0; i < a.size(); ++i) {
-                        a[i] = a[i] * sconst;
-                    }
+                    parallel_for(0, a.size(), [&a, &sconst](std::size_t i) { a[i] = a[i] * sconst; });
                 }
 
                 std::vector<field_value_type> evaluate_all_lagrange_polynomials(const field_value_type &t) override {
@@ -136,6 +169,38 @@ namespace nil {
                     return omega.pow(idx);
                 }
 
+                /**
+                 * Discrete logarithm of x to the base omega, recovered bit by bit from the lowest one:
+                 * once the known low bits are divided out, raising the rest to the power m / 2^(j+1)
+                 * gives 1 or -1 depending on bit j. Takes O(log^2 m) multiplications.
+                 */
+                std::size_t get_domain_element_index(const field_value_type &x) override {
+                    if (x == field_value_type::zero()) {
+                        return this->m;
+                    }
+
+                    std::size_t idx = 0;
+                    field_value_type y = x;
+                    field_value_type omega_inverse_power = omega.inversed();
+                    for (std::size_t j = 0; j < this->log2_size; ++j) {
+                        field_value_type sign = y;
+                        for (std::size_t i = j + 1; i < this->log2_size; ++i) {
+                            sign = sign.squared();
+                        }
+
+                        if (sign != field_value_type::one()) {
+                            if (sign != -field_value_type::one()) {
+                                return this->m;
+                            }
+                            idx |= std::size_t(1) << j;
+                            y *= omega_inverse_power;
+                        }
+                        omega_inverse_power = omega_inverse_power.squared();
+                    }
+
+                    return y == field_value_type::one() ? idx : this->m;
+                }
+
                 field_value_type compute_vanishing_polynomial(const field_value_type &t) override {
                     return (t.pow(this->m)) - field_value_type::one();
                 }
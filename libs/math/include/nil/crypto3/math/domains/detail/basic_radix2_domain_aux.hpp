@@ -35,12 +35,31 @@
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
             namespace detail {
 
+                /*
+                 * Number of elements transformed together by basic_radix2_fft_cached_blocked before moving on
+                 * to the next block. 2^12 elements of a 256-bit field take 128 KiB, i.e. fit into L2 cache.
+                 */
+                constexpr std::size_t fft_cache_block_size = std::size_t(1) << 12;
+
+                /*
+                 * Minimal number of butterflies handed to one thread in the whole-sequence stages of
+                 * basic_radix2_fft_cached_blocked.
+                 */
+                constexpr std::size_t fft_parallel_chunk_size = std::size_t(1) << 10;
+
+                /*
+                 * Domains of this size and larger use the cache-blocked (and, with MULTICORE, multi-threaded)
+                 * fft in basic_radix2_domain.
+                 */
+                constexpr std::size_t fft_blocked_threshold = std::size_t(1) << 14;
+
                 /*
                  * Building caches for fft operations
                 */
@@ -97,6 +116,106 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Runs butterfly stages [first_stage, last_stage] on the length-n sequence starting at offset.
+                 * omega_cache holds powers of a root of unity of order cache_size, so a stage with half-size m
+                 * uses every (cache_size / (2 * m))-th power.
+                 */
+                template<typename Range, typename OmegaCache>
+                void basic_radix2_fft_stages(Range &a, const std::size_t offset, const std::size_t n,
+                                             const std::size_t first_stage, const std::size_t last_stage,
+                                             const OmegaCache &omega_cache, const std::size_t cache_size) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    value_type t;
+                    for (std::size_t s = first_stage, m = std::size_t(1) << (first_stage - 1),
+                                     inc = cache_size >> first_stage;
+                         s <= last_stage; ++s, m <<= 1, inc >>= 1) {
+                        for (std::size_t k = offset; k < offset + n; k += 2 * m) {
+                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
+                                t = a[k + j + m];
+                                t *= omega_cache[idx];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
+                /*
+                 * Cache-blocked version of basic_radix2_fft_cached. After the bit-reversal permutation the first
+                 * log2(block_size) stages only touch contiguous blocks of block_size elements, so every block
+                 * is transformed to completion while it is still in cache. The remaining stages are done one by
+                 * one over the whole sequence, splitting the n / 2 independent butterflies of a stage into
+                 * contiguous chunks.
+                 *
+                 * If MULTICORE is defined, blocks and butterfly chunks are distributed with OpenMP over
+                 * worker_count() threads, see parallelization.hpp.
+                 *
+                 * Every element goes through exactly the same sequence of operations as in
+                 * basic_radix2_fft_cached, so the results are identical.
+                 * Also, note that it's the caller's responsibility to multiply by 1/N.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_cached_blocked(Range &a,
+                                                     const std::vector<typename FieldType::value_type> &omega_cache,
+                                                     const std::size_t block_size = fft_cache_block_size) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (block_size == 0 || (block_size & (block_size - 1)) != 0)
+                        throw std::invalid_argument("expected block_size to be a power of two");
+
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(worker_count())
+#endif
+                    for (std::size_t k = 0; k < n; ++k) {
+                        const std::size_t rk = bitreverse(k, logn);
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
+                    }
+
+                    const std::size_t block = std::min(n, block_size);
+                    const std::size_t block_logn = log2(block);
+
+                    if (block_logn > 0) {
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(worker_count())
+#endif
+                        for (std::size_t offset = 0; offset < n; offset += block) {
+                            basic_radix2_fft_stages(a, offset, block, 1, block_logn, omega_cache, n);
+                        }
+                    }
+
+                    const std::size_t half = n / 2;
+                    const std::size_t chunk = std::min(half, fft_parallel_chunk_size);
+                    for (std::size_t s = block_logn + 1, m = block, inc = n >> (block_logn + 1); s <= logn;
+                         ++s, m <<= 1, inc >>= 1) {
+#ifdef MULTICORE
+#pragma omp parallel for num_threads(worker_count())
+#endif
+                        for (std::size_t first = 0; first < half; first += chunk) {
+                            value_type t;
+                            // butterfly number i pairs a[k + j] with a[k + j + m], k = (i / m) * 2m, j = i % m
+                            for (std::size_t i = first; i < first + chunk; ++i) {
+                                const std::size_t j = i & (m - 1);
+                                const std::size_t k = (i - j) << 1;
+                                t = a[k + j + m];
+                                t *= omega_cache[j * inc];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
                 /**
                  * Note that it's the caller's responsibility to multiply by 1/N.
                  */
@@ -76,6 +76,19 @@ namespace nil {
                  */
                 virtual field_value_type get_domain_element(const std::size_t idx) = 0;
 
+                /**
+                 * Get the index of x in S, i.e. the idx such that get_domain_element(idx) == x.
+                 * Returns size() if x is not in S.
+                 */
+                virtual std::size_t get_domain_element_index(const field_value_type &x) {
+                    for (std::size_t idx = 0; idx < m; ++idx) {
+                        if (get_domain_element(idx) == x) {
+                            return idx;
+                        }
+                    }
+                    return m;
+                }
+
                 /**
                  * Compute the FFT, over the domain S, of the vector a.
                  */
@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MATH_PARALLELIZATION_HPP
+#define CRYPTO3_MATH_PARALLELIZATION_HPP
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /*
+                 * Element-wise operations over fewer elements than this run on the calling thread,
+                 * the cost of waking up the workers is higher than the work itself.
+                 */
+                constexpr std::size_t parallel_threshold = std::size_t(1) << 12;
+
+                inline std::size_t default_worker_count() {
+                    if (const char *env = std::getenv("CRYPTO3_NUM_THREADS")) {
+                        const long count = std::strtol(env, nullptr, 10);
+                        if (count > 0) {
+                            return static_cast<std::size_t>(count);
+                        }
+                    }
+#ifdef MULTICORE
+                    return static_cast<std::size_t>(omp_get_max_threads());
+#else
+                    return 1;
+#endif
+                }
+
+                inline std::atomic<std::size_t> &worker_count_storage() {
+                    static std::atomic<std::size_t> count(default_worker_count());
+                    return count;
+                }
+            }    // namespace detail
+
+            /*
+             * Number of workers used by the parallel math primitives. It is taken from the CRYPTO3_NUM_THREADS
+             * env var if set, otherwise it is the OpenMP default (OMP_NUM_THREADS or the number of cores).
+             * Without MULTICORE everything runs on the calling thread.
+             */
+            inline std::size_t worker_count() {
+                return detail::worker_count_storage().load(std::memory_order_relaxed);
+            }
+
+            /*
+             * Overrides the number of workers, 0 restores the default.
+             */
+            inline void set_worker_count(std::size_t count) {
+                detail::worker_count_storage().store(count == 0 ? detail::default_worker_count() : count,
+                                                     std::memory_order_relaxed);
+            }
+
+            /*
+             * Calls func(i) for every i in [begin, end). The range is split into one contiguous chunk per
+             * worker of the shared OpenMP thread pool if it has at least threshold elements.
+             * Calls from inside another parallel region run on the calling thread.
+             */
+            template<typename Func>
+            void parallel_for(std::size_t begin, std::size_t end, Func &&func,
+                              std::size_t threshold = detail::parallel_threshold) {
+                if (begin >= end) {
+                    return;
+                }
+#ifdef MULTICORE
+                const std::size_t workers = std::min(worker_count(), end - begin);
+                if (workers > 1 && end - begin >= threshold && !omp_in_parallel()) {
+#pragma omp parallel for schedule(static) num_threads(workers)
+                    for (std::size_t i = begin; i < end; ++i) {
+                        func(i);
+                    }
+                    return;
+                }
+#endif
+                for (std::size_t i = begin; i < end; ++i) {
+                    func(i);
+                }
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PARALLELIZATION_HPP
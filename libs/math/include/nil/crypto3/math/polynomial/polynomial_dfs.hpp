@@ -41,6 +41,7 @@
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -441,10 +442,10 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
 
-                        std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(), std::plus<FieldValueType>());
+                        parallel_for(0, this->size(), [this, &tmp](std::size_t i) { val[i] += tmp.val[i]; });
                         return *this;
                     }
-                    std::transform(other.begin(), other.end(), this->begin(), this->begin(), std::plus<FieldValueType>());
+                    parallel_for(0, this->size(), [this, &other](std::size_t i) { val[i] += other.val[i]; });
                     return *this;
                 }
 
@@ -453,7 +454,7 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs& operator+=(const FieldValueType& c) {
-                    for( auto it = this->begin(); it!=this->end(); it++) *it += c;
+                    parallel_for(0, this->size(), [this, &c](std::size_t i) { val[i] += c; });
                     return *this;
                 }
 
@@ -462,8 +463,8 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs operator-() const {
-                    polynomial_dfs result(this->_d, this->begin(), this->end());
-                    std::transform(this->begin(), this->end(), result.begin(), std::negate<FieldValueType>());
+                    polynomial_dfs result(this->_d, this->size());
+                    parallel_for(0, this->size(), [this, &result](std::size_t i) { result.val[i] = -val[i]; });
                     return result;
                 }
 
@@ -490,10 +491,10 @@ namespace nil {
                     if (this->size() > other.size()) {
                         polynomial_dfs tmp(other);
                         tmp.resize(this->size());
-                        std::transform(this->begin(), this->end(), tmp.begin(), this->begin(), std::minus<FieldValueType>());
+                        parallel_for(0, this->size(), [this, &tmp](std::size_t i) { val[i] -= tmp.val[i]; });
                         return *this;
                     }
-                    std::transform(this->begin(), this->end(), other.begin(), this->begin(), std::minus<FieldValueType>());
+                    parallel_for(0, this->size(), [this, &other](std::size_t i) { val[i] -= other.val[i]; });
                     return *this;
                 }
 
@@ -502,7 +503,7 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs& operator-=(const FieldValueType& c) {
-                    for( auto it = this->begin(); it!=this->end(); it++) *it -= c;
+                    parallel_for(0, this->size(), [this, &c](std::size_t i) { val[i] -= c; });
                     return *this;
                 }
 
@@ -549,10 +550,10 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(polynomial_s, other_domain, new_domain);
 
-                        std::transform(tmp.begin(), tmp.end(), this->begin(), this->begin(), std::multiplies<FieldValueType>());
+                        parallel_for(0, this->size(), [this, &tmp](std::size_t i) { val[i] *= tmp.val[i]; });
                         return *this;
                     }
-                    std::transform(this->begin(), this->end(), other.begin(), this->begin(), std::multiplies<FieldValueType>());
+                    parallel_for(0, this->size(), [this, &other](std::size_t i) { val[i] *= other.val[i]; });
                     return *this;
                 }
 
@@ -561,7 +562,7 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs& operator*=(const FieldValueType& alpha) {
-                    for( auto it = this->begin(); it!=this->end(); it++) *it *= alpha;
+                    parallel_for(0, this->size(), [this, &alpha](std::size_t i) { val[i] *= alpha; });
                     return *this;
                 }
 
@@ -653,9 +654,9 @@ namespace nil {
                     result.resize(expected_size);
                     result._d = _d * power;
 
-                    for (std::size_t i = 0; i < result.size(); ++i) {
+                    parallel_for(0, result.size(), [&result, power](std::size_t i) {
                         result[i] = result[i].pow(power);
-                    }
+                    }, 1 << 8);
 
                     return result;
                 }
@@ -667,9 +668,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator+(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
                 polynomial_dfs<FieldValueType> result(A);
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it += B;
-                }
+                result += B;
                 return result;
             }
 
@@ -678,9 +677,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator+(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
                 polynomial_dfs<FieldValueType> result(B);
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it += A;
-                }
+                result += A;
                 return result;
             }
 
@@ -690,9 +687,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator-(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
                 polynomial_dfs<FieldValueType> result(A);
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it -=  B;
-                }
+                result -= B;
                 return result;
             }
 
@@ -701,9 +696,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator-(const FieldValueType& A,
                                                             const polynomial_dfs<FieldValueType, Allocator>& B) {
                 polynomial_dfs<FieldValueType> result(B);
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it = A - *it;
-                }
+                parallel_for(0, result.size(), [&result, &A](std::size_t i) { result[i] = A - result[i]; });
                 return result;
             }
 
@@ -712,9 +705,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator*(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
                 polynomial_dfs<FieldValueType> result(A);
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it *= B;
-                }
+                result *= B;
                 return result;
             }
 
@@ -731,10 +722,7 @@ namespace nil {
             polynomial_dfs<FieldValueType, Allocator> operator/(const polynomial_dfs<FieldValueType, Allocator>& A,
                                                             const FieldValueType& B) {
                 polynomial_dfs<FieldValueType> result(A);
-                FieldValueType B_inversed = B.inversed();
-                for( auto it = result.begin(); it != result.end(); it++ ){
-                    *it *= B_inversed;
-                }
+                result *= B.inversed();
                 return result;
             }
 
@@ -802,9 +790,8 @@ namespace nil {
             template<typename FieldType>
             static inline polynomial_dfs<typename FieldType::value_type> polynomial_product(
                     std::vector<math::polynomial_dfs<typename FieldType::value_type>> multipliers) {
-                // Pre-create all the domains. We could do this on-the-go, but we want this function to be more
-                // parallelization-friendly. This single-threaded version may look a bit complicated,
-                // but it's now very similar to what we have in parallel code.
+                // Pre-create all the domains, so that the map is not modified while the products below
+                // run in parallel.
                 std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domain_cache;
 
                 std::size_t min_domain_size = std::numeric_limits<std::size_t>::max();
@@ -825,19 +812,19 @@ namespace nil {
                     domain_cache[i] = nullptr;
                 }
 
-                // This loop will run in parallel.
                 for (const auto& domain_size: needed_domain_sizes) {
                     domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
                 }
 
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
                     const std::size_t double_stride = stride << 1;
-                    // This loop will run in parallel.
                     std::size_t max_i = (multipliers.size() - stride) / double_stride;
                     if ((multipliers.size() - stride) % double_stride != 0)
                         max_i++;
 
-                    for(std::size_t i = 0; i < max_i; i++) {
+                    // Products of independent pairs run in parallel while there are at least two of them,
+                    // the last few levels use parallel element-wise multiplication and FFTs instead.
+                    parallel_for(0, max_i, [&](std::size_t i) {
                         std::size_t index1 = i * double_stride;
                         std::size_t index2 = index1 + stride;
 
@@ -851,13 +838,13 @@ namespace nil {
 
                         multipliers[index1].cached_multiplication(
                             multipliers[index2],
-                            domain_cache[current_domain_size],
-                            domain_cache[next_domain_size],
-                            domain_cache[new_domain_size]);
+                            domain_cache.at(current_domain_size),
+                            domain_cache.at(next_domain_size),
+                            domain_cache.at(new_domain_size));
 
                         // Free the memory we are not going to use anymore.
                         multipliers[index2] = polynomial_dfs<typename FieldType::value_type>();
-                    }
+                    }, 2);
                 }
                 return multipliers[0];
             }
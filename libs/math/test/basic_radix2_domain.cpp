@@ -38,6 +38,7 @@
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
@@ -111,6 +112,104 @@ BOOST_AUTO_TEST_CASE(basic_radix2_domain_benchmark, *boost::unit_test::disabled(
               << " ms" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(blocked_fft_matches_textbook_fft) {
+    using value_type = FieldType::value_type;
+    for (std::size_t log_size = 1; log_size <= 16; ++log_size) {
+        const std::size_t fft_size = std::size_t(1) << log_size;
+        std::vector<value_type> test_data(fft_size);
+        for (std::size_t i = 0; i < fft_size; ++i) {
+            test_data[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> omega_powers;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(
+            fft_size, unity_root<FieldType>(fft_size), omega_powers);
+
+        std::vector<value_type> expected(test_data);
+        nil::crypto3::math::detail::basic_radix2_fft_cached<FieldType>(expected, omega_powers);
+
+        for (std::size_t block_size : {std::size_t(1), std::size_t(4), std::size_t(1) << 8,
+                                       nil::crypto3::math::detail::fft_cache_block_size}) {
+            std::vector<value_type> blocked(test_data);
+            nil::crypto3::math::detail::basic_radix2_fft_cached_blocked<FieldType>(
+                blocked, omega_powers, block_size);
+            BOOST_CHECK(blocked == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blocked_fft_domain_round_trip) {
+    using value_type = FieldType::value_type;
+    const std::size_t fft_size = nil::crypto3::math::detail::fft_blocked_threshold << 1;
+    std::vector<value_type> test_data(fft_size);
+    for (std::size_t i = 0; i < fft_size; ++i) {
+        test_data[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+
+    basic_radix2_domain<FieldType> domain(fft_size);
+    std::vector<value_type> a(test_data);
+    domain.fft(a);
+    BOOST_CHECK(a[3] == polynomial<value_type>(test_data.begin(), test_data.end()).evaluate(
+        domain.get_domain_element(3)));
+    domain.inverse_fft(a);
+    BOOST_CHECK(a == test_data);
+}
+
+BOOST_AUTO_TEST_CASE(domain_element_index_lookup) {
+    using value_type = FieldType::value_type;
+    for (std::size_t log_size = 1; log_size <= 10; ++log_size) {
+        const std::size_t domain_size = std::size_t(1) << log_size;
+        basic_radix2_domain<FieldType> domain(domain_size);
+
+        value_type element = value_type::one();
+        for (std::size_t i = 0; i < domain_size; ++i) {
+            BOOST_CHECK_EQUAL(domain.get_domain_element_index(element), i);
+            element *= domain.omega;
+        }
+
+        // Elements outside the domain: zero, a root of unity of twice the order and a random element
+        BOOST_CHECK_EQUAL(domain.get_domain_element_index(value_type::zero()), domain_size);
+        BOOST_CHECK_EQUAL(domain.get_domain_element_index(unity_root<FieldType>(domain_size << 1)), domain_size);
+        BOOST_CHECK_EQUAL(domain.get_domain_element_index(value_type(3)), domain_size);
+    }
+
+    // Random challenge mapped into the domain, as FRI does for its query positions
+    const std::size_t domain_size = 1 << 20;
+    basic_radix2_domain<FieldType> domain(domain_size);
+    value_type x = nil::crypto3::algebra::random_element<FieldType>().pow((FieldType::modulus - 1) / domain_size);
+    std::size_t idx = domain.get_domain_element_index(x);
+    BOOST_CHECK(idx < domain_size);
+    BOOST_CHECK(domain.get_domain_element(idx) == x);
+}
+
+BOOST_AUTO_TEST_CASE(blocked_fft_benchmark, *boost::unit_test::disabled()) {
+    using value_type = FieldType::value_type;
+    for (std::size_t log_size = 16; log_size <= 22; log_size += 2) {
+        const std::size_t fft_size = std::size_t(1) << log_size;
+        std::vector<value_type> test_data(fft_size);
+        for (std::size_t i = 0; i < fft_size; ++i) {
+            test_data[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        std::vector<value_type> omega_powers;
+        nil::crypto3::math::detail::create_fft_cache<FieldType>(
+            fft_size, unity_root<FieldType>(fft_size), omega_powers);
+        std::vector<value_type> duped_data(test_data);
+
+        std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+        nil::crypto3::math::detail::basic_radix2_fft_cached<FieldType>(test_data, omega_powers);
+        auto textbook = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        nil::crypto3::math::detail::basic_radix2_fft_cached_blocked<FieldType>(duped_data, omega_powers);
+        auto blocked = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+
+        BOOST_CHECK(test_data == duped_data);
+        std::cout << "FFT 2^" << log_size << ": textbook " << textbook << " ms, blocked " << blocked << " ms"
+                  << std::endl;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(fft_vs_multiplication_benchmark) {
     using value_type = FieldType::value_type;
     const std::size_t fft_size = 1 << 16;
@@ -26,6 +26,7 @@
 
 #define BOOST_TEST_MODULE polynomial_dfs_test
 
+#include <algorithm>
 #include <vector>
 #include <cstdint>
 
@@ -40,6 +41,9 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
+#include <nil/crypto3/math/algorithms/low_degree_extension.hpp>
+#include <nil/crypto3/math/algorithms/barycentric_evaluation.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -1409,3 +1413,145 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_equality_check_perf_test, *boost::unit_test:
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_parallel_test_suite)
+
+// Sizes above detail::parallel_threshold take the parallel path, the results must not depend on the worker count.
+BOOST_AUTO_TEST_CASE(polynomial_dfs_parallel_elementwise_test) {
+    using value_type = typename FieldType::value_type;
+    const std::size_t size = detail::parallel_threshold << 2;
+
+    std::vector<value_type> a_values(size), b_values(size / 2);
+    for (auto &v : a_values) {
+        v = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    for (auto &v : b_values) {
+        v = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    polynomial_dfs<value_type> a(size - 1, a_values), b(size / 2 - 1, b_values);
+    value_type c = nil::crypto3::algebra::random_element<FieldType>();
+
+    auto compute = [&]() {
+        std::vector<polynomial_dfs<value_type>> results;
+        results.push_back(a + b);
+        results.push_back(a - b);
+        results.push_back(b * b);
+        results.push_back(-a);
+        results.push_back(a * c);
+        results.push_back(c - a);
+        results.push_back(b.pow(3));
+        results.push_back(polynomial_product<FieldType>({a, b, b, a, b}));
+        return results;
+    };
+
+    set_worker_count(1);
+    auto serial = compute();
+    set_worker_count(4);
+    auto parallel = compute();
+    set_worker_count(0);
+
+    BOOST_CHECK(serial == parallel);
+    BOOST_CHECK(serial[0][7] == a[7] + b.evaluate(unity_root<FieldType>(size).pow(7)));
+    BOOST_CHECK(serial[4][5] == a[5] * c);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_low_degree_extension_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_low_degree_extension_matches_resize) {
+    using value_type = typename FieldType::value_type;
+    const std::size_t extended_size = 1 << 10;
+
+    std::vector<polynomial_dfs<value_type>> columns;
+    for (std::size_t size : {1u << 8, 1u << 8, 1u << 6, 1u << 10, 1u}) {
+        std::vector<value_type> values(size);
+        for (auto &v : values) {
+            v = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        columns.emplace_back(size - 1, values);
+    }
+
+    std::vector<value_type> matrix;
+    low_degree_extension<FieldType>(columns, extended_size, matrix);
+    BOOST_CHECK_EQUAL(matrix.size(), columns.size() * extended_size);
+
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        polynomial_dfs<value_type> expected = columns[c];
+        expected.resize(extended_size);
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), matrix.begin() + c * extended_size));
+    }
+
+    // On a coset the values are the evaluations at shift * omega^i.
+    const value_type shift = detail::coset_shift<FieldType>();
+    const value_type omega = unity_root<FieldType>(extended_size);
+    low_degree_extension<FieldType>(columns, extended_size, matrix, shift);
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        for (std::size_t i : {0u, 1u, 517u}) {
+            BOOST_CHECK(matrix[c * extended_size + i] == columns[c].evaluate(shift * omega.pow(i)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_barycentric_evaluation_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_barycentric_evaluation_matches_evaluate) {
+    using value_type = typename FieldType::value_type;
+
+    std::vector<polynomial_dfs<value_type>> columns;
+    for (std::size_t size : {1u << 10, 1u << 10, 1u << 6, 1u}) {
+        std::vector<value_type> values(size);
+        for (auto &v : values) {
+            v = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        columns.emplace_back(size - 1, values);
+    }
+
+    // A random point and a point of the largest domain.
+    std::vector<value_type> points = {nil::crypto3::algebra::random_element<FieldType>(),
+                                      unity_root<FieldType>(1 << 10).pow(5)};
+
+    barycentric_evaluator<FieldType> evaluator;
+    for (const auto &column : columns) {
+        for (const auto &point : points) {
+            evaluator.add(column.size(), point);
+        }
+    }
+    for (const auto &column : columns) {
+        for (const auto &point : points) {
+            BOOST_CHECK(evaluator.evaluate(column, point) == column.evaluate(point));
+        }
+    }
+    BOOST_CHECK(evaluator.evaluate(columns[0], points[1]) == columns[0][5]);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_barycentric_evaluation_combined) {
+    using value_type = typename FieldType::value_type;
+    const std::size_t size = 1 << 8;
+
+    std::vector<polynomial_dfs<value_type>> columns;
+    for (std::size_t c = 0; c < 5; ++c) {
+        std::vector<value_type> values(size);
+        for (auto &v : values) {
+            v = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        columns.emplace_back(size - 1, values);
+    }
+    value_type theta = nil::crypto3::algebra::random_element<FieldType>();
+    value_type point = nil::crypto3::algebra::random_element<FieldType>();
+
+    barycentric_evaluator<FieldType> evaluator;
+    evaluator.add(size, point);
+
+    value_type expected = value_type::zero();
+    value_type theta_acc = value_type::one();
+    for (const auto &column : columns) {
+        expected += theta_acc * column.evaluate(point);
+        theta_acc *= theta;
+    }
+    BOOST_CHECK(evaluator.evaluate_combined(columns, theta, point) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,39 +22,45 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
+
 #ifndef CRYPTO3_MODE_AEAD_GCM_HPP
 #define CRYPTO3_MODE_AEAD_GCM_HPP
 
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/static_assert.hpp>
+
 #include <nil/crypto3/modes/aead/aead.hpp>
+#include <nil/crypto3/modes/ctr.hpp>
 
 #include <nil/crypto3/hash/ghash.hpp>
 
 namespace nil {
     namespace crypto3 {
-        namespace hashes {
-            struct ghash;
-        }
-        namespace stream {
-            template<typename BlockCipher>
-            class ctr;
-        }
         namespace block {
             namespace modes {
                 namespace detail {
-                    template<typename Cipher, std::size_t TagBits, typename Padding, typename StreamCipher,
-                             typename HashType, template<typename> class Allocator>
+                    template<typename Cipher, std::size_t TagBits, typename HashType,
+                             template<typename> class Allocator>
                     struct gcm_policy {
                         typedef Cipher cipher_type;
-                        typedef Padding padding_type;
-                        typedef StreamCipher stream_cipher_type;
                         typedef HashType hash_type;
 
                         template<typename T>
                         using allocator_type = Allocator<T>;
 
                         constexpr static const std::size_t tag_bits = TagBits;
+                        constexpr static const std::size_t tag_bytes = tag_bits / CHAR_BIT;
 
                         BOOST_STATIC_ASSERT(tag_bits >= 12 * CHAR_BIT && tag_bits <= 16 * CHAR_BIT);
+                        BOOST_STATIC_ASSERT(tag_bits % CHAR_BIT == 0);
 
                         constexpr static const std::size_t block_bits = cipher_type::block_bits;
                         constexpr static const std::size_t block_words = cipher_type::block_words;
@@ -62,152 +68,104 @@ namespace nil {
 
                         BOOST_STATIC_ASSERT(block_bits == 128);
 
-                        typedef std::vector<boost::uint_t<CHAR_BIT>, allocator_type<boost::uint_t<CHAR_BIT>>>
-                            associated_data_type;
-                        typedef std::vector<boost::uint_t<CHAR_BIT>, allocator_type<boost::uint_t<CHAR_BIT>>>
-                            nonce_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type block = {0};
+                        typedef std::vector<std::uint8_t, allocator_type<std::uint8_t>> associated_data_type;
+                        typedef std::vector<std::uint8_t, allocator_type<std::uint8_t>> nonce_type;
+                        typedef std::array<std::uint8_t, tag_bytes> tag_type;
 
-                            // any size is valid for GCM nonce
+                        typedef ctr_keystream<cipher_type, 32> counter_type;
 
-                            secure_vector<uint8_t> y0(GCM_BS);
+                        /// Sets up the counter and the tag mask E(J0) for a message and absorbs the associated data.
+                        static void begin_message(const cipher_type &cipher, hash_type &hash, counter_type &counter,
+                                                  block_type &tag_mask, const std::uint8_t *nonce,
+                                                  std::size_t nonce_bytes, const associated_data_type &ad) {
+                            if (nonce_bytes == 0) {
+                                throw std::invalid_argument("GCM nonce must not be empty");
+                            }
 
-                            if (nonce_len == 12) {
-                                copy_mem(y0.data(), nonce, nonce_len);
-                                y0[15] = 1;
+                            block_type pre_counter;
+                            std::uint8_t *j0 = reinterpret_cast<std::uint8_t *>(pre_counter.data());
+                            if (nonce_bytes == 12) {
+                                std::memcpy(j0, nonce, nonce_bytes);
+                                j0[12] = j0[13] = j0[14] = 0;
+                                j0[15] = 1;
                             } else {
-                                y0 = m_ghash->nonce_hash(nonce, nonce_len);
+                                const typename hash_type::digest_type y0 = hash.nonce_hash(nonce, nonce_bytes);
+                                std::memcpy(j0, y0.data(), y0.size());
                             }
 
-                            m_ctr->set_iv(y0.data(), y0.size());
+                            // The first keystream block is E(inc32(J0)), E(J0) masks the tag
+                            counter.reset(pre_counter);
+                            counter.skip(1);
+                            tag_mask = cipher.encrypt(pre_counter);
 
-                            zeroise(y0);
-                            m_ctr->encipher(y0);
+                            hash.reset();
+                            hash.update_associated_data(ad.data(), ad.size());
+                        }
 
-                            m_ghash->start(y0.data(), y0.size());
+                        static tag_type compute_tag(hash_type &hash, const block_type &tag_mask) {
+                            const typename hash_type::digest_type s = hash.final();
+                            const std::uint8_t *mask = reinterpret_cast<const std::uint8_t *>(tag_mask.data());
 
-                            return cipher.encrypt(block);
+                            tag_type tag;
+                            for (std::size_t i = 0; i < tag_bytes; i++) {
+                                tag[i] = s[i] ^ mask[i];
+                            }
+                            return tag;
                         }
                     };
 
-                    template<typename Cipher, std::size_t TagBits, typename Padding, typename StreamCipher,
-                             typename HashType, template<typename> class Allocator>
-                    class gcm_encryption_policy
-                        : public gcm_policy<Cipher, TagBits, Padding, StreamCipher, HashType, Allocator> {
-                        typedef gcm_policy<Cipher, TagBits, Padding, StreamCipher, HashType, Allocator> policy_type;
+                    template<typename Cipher, std::size_t TagBits, typename HashType,
+                             template<typename> class Allocator>
+                    struct gcm_encryption_policy : public gcm_policy<Cipher, TagBits, HashType, Allocator> {
+                        typedef gcm_policy<Cipher, TagBits, HashType, Allocator> policy_type;
 
-                    public:
                         typedef typename policy_type::cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
-                        typedef typename policy_type::stream_cipher_type stream_cipher_type;
                         typedef typename policy_type::hash_type hash_type;
-
-                        typedef typename policy_type::associated_data_type associated_data_type;
-                        typedef typename policy_type::nonce_type nonce_type;
-
-                        constexpr static const std::size_t tag_bits = policy_type::tag_bits;
-
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
                         typedef typename policy_type::block_type block_type;
+                        typedef typename policy_type::counter_type counter_type;
+                        typedef typename policy_type::tag_type tag_type;
 
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return policy_type::begin_message(cipher, plaintext);
+                        static void process(const cipher_type &cipher, hash_type &hash, counter_type &counter,
+                                            const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            counter.apply(cipher, in, out, length);
+                            hash.update(out, length);
                         }
 
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type block = {0};
-
-                            CRYPTO3_ARG_CHECK(sz % update_granularity() == 0);
-                            m_ctr->cipher(buf, buf, sz);
-                            m_ghash->update(buf, sz);
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type result = {0};
-
-                            CRYPTO3_ARG_CHECK(offset <= buffer.size());
-                            const size_t sz = buffer.size() - offset;
-                            uint8_t *buf = buffer.data() + offset;
-
-                            m_ctr->cipher(buf, buf, sz);
-                            m_ghash->update(buf, sz);
-                            auto mac = m_ghash->final();
-                            buffer += std::make_pair(mac.data(), tag_size());
-
-                            return result;
+                        static tag_type end_message(hash_type &hash, const block_type &tag_mask) {
+                            return policy_type::compute_tag(hash, tag_mask);
                         }
                     };
 
-                    template<typename Cipher, std::size_t TagBits, typename Padding, typename StreamCipher,
-                             typename HashType, template<typename> class Allocator>
-                    struct gcm_decryption_policy
-                        : public gcm_policy<Cipher, TagBits, Padding, StreamCipher, HashType, Allocator> {
-                        typedef gcm_policy<Cipher, TagBits, Padding, StreamCipher, HashType, Allocator> policy_type;
+                    template<typename Cipher, std::size_t TagBits, typename HashType,
+                             template<typename> class Allocator>
+                    struct gcm_decryption_policy : public gcm_policy<Cipher, TagBits, HashType, Allocator> {
+                        typedef gcm_policy<Cipher, TagBits, HashType, Allocator> policy_type;
 
-                    public:
                         typedef typename policy_type::cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
-                        typedef typename policy_type::stream_cipher_type stream_cipher_type;
                         typedef typename policy_type::hash_type hash_type;
-
-                        typedef typename policy_type::associated_data_type associated_data_type;
-                        typedef typename policy_type::nonce_type nonce_type;
-
-                        constexpr static const std::size_t tag_bits = policy_type::tag_bits;
-
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
                         typedef typename policy_type::block_type block_type;
+                        typedef typename policy_type::counter_type counter_type;
+                        typedef typename policy_type::tag_type tag_type;
 
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return policy_type::begin_message(cipher, plaintext);
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type block = {0};
-
-                            CRYPTO3_ARG_CHECK(sz % update_granularity() == 0);
-                            m_ghash->update(buf, sz);
-                            m_ctr->cipher(buf, buf, sz);
-
-                            return cipher.encrypt(block);
+                        static void process(const cipher_type &cipher, hash_type &hash, counter_type &counter,
+                                            const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            hash.update(in, length);
+                            counter.apply(cipher, in, out, length);
                         }
 
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            block_type result = {0};
-
-                            CRYPTO3_ARG_CHECK(offset <= buffer.size());
-                            const size_t sz = buffer.size() - offset;
-                            uint8_t *buf = buffer.data() + offset;
-
-                            if (sz < tag_size()) {
-                                throw Exception("Insufficient input for GCM decryption, tag missing");
+                        /// Compares the tags in constant time
+                        static bool end_message(hash_type &hash, const block_type &tag_mask,
+                                                const std::uint8_t *tag, std::size_t tag_bytes) {
+                            const tag_type expected = policy_type::compute_tag(hash, tag_mask);
+                            if (tag_bytes != expected.size()) {
+                                return false;
                             }
 
-                            const size_t remaining = sz - tag_size();
-
-                            // handle any final input before the tag
-                            if (remaining) {
-                                m_ghash->update(buf, remaining);
-                                m_ctr->cipher(buf, buf, remaining);
-                            }
-
-                            auto mac = m_ghash->final();
-
-                            const uint8_t *included_tag = &buffer[remaining + offset];
-
-                            if (!constant_time_compare(mac.data(), included_tag, tag_size())) {
-                                throw integrity_failure("GCM tag check failed");
+                            std::uint8_t difference = 0;
+                            for (std::size_t i = 0; i < tag_bytes; i++) {
+                                difference |= expected[i] ^ tag[i];
                             }
-
-                            buffer.resize(offset + remaining);
-
-                            return result;
+                            return difference == 0;
                         }
                     };
 
@@ -217,100 +175,109 @@ namespace nil {
 
                     public:
                         typedef typename policy_type::cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
+                        typedef typename policy_type::hash_type hash_type;
 
                         typedef typename cipher_type::key_type key_type;
                         typedef typename policy_type::associated_data_type associated_data_type;
                         typedef typename policy_type::nonce_type nonce_type;
+                        typedef typename policy_type::tag_type tag_type;
 
                         constexpr static const std::size_t block_bits = policy_type::block_bits;
                         constexpr static const std::size_t block_words = policy_type::block_words;
                         typedef typename cipher_type::block_type block_type;
 
+                        constexpr static const std::size_t tag_bits = policy_type::tag_bits;
+
                         template<typename AssociatedDataContainer>
                         gcm(const cipher_type &cipher, const AssociatedDataContainer &associated_data) :
                             cipher(cipher) {
+                            schedule_key();
                             schedule_associated_data(associated_data);
                         }
 
                         template<typename AssociatedDataContainer>
                         gcm(const key_type &key, const AssociatedDataContainer &associated_data) : cipher(key) {
-
-                            m_ctr->set_key(key, keylen);
-
-                            const std::vector<uint8_t> zeros(GCM_BS);
-                            m_ctr->set_iv(zeros.data(), zeros.size());
-
-                            secure_vector<uint8_t> H(GCM_BS);
-                            m_ctr->encipher(H);
-                            m_ghash->set_key(H);
-
+                            schedule_key();
                             schedule_associated_data(associated_data);
                         }
 
-                        inline block_type begin_message(const block_type &plaintext) {
-                            return policy_type::begin_message(cipher, plaintext, ad);
+                        /// Starts a message. Any nonce length is accepted, 96 bits is the recommended one.
+                        template<typename NonceContainer>
+                        inline void begin_message(const NonceContainer &nonce) {
+                            const nonce_type n(std::begin(nonce), std::end(nonce));
+                            policy_type::begin_message(cipher, hash, counter, tag_mask, n.data(), n.size(), ad);
                         }
 
-                        inline block_type process_block(const block_type &plaintext) {
-                            return policy_type::process_block(cipher, plaintext, ad);
+                        /// Encrypts or decrypts length bytes, in and out may be the same buffer.
+                        inline void process(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            policy_type::process(cipher, hash, counter, in, out, length);
                         }
 
-                        inline block_type end_message(const block_type &plaintext) {
-                            return policy_type::end_message(cipher, plaintext, ad);
+                        /// Returns the tag of an encrypted message
+                        inline tag_type end_message() {
+                            return policy_type::end_message(hash, tag_mask);
                         }
 
-                        inline static std::size_t required_output_size(std::size_t inputlen) {
-                            return padding_type::required_output_size(inputlen);
+                        /// Checks the tag of a decrypted message
+                        template<typename TagContainer>
+                        inline bool end_message(const TagContainer &tag) {
+                            const std::vector<std::uint8_t> t(std::begin(tag), std::end(tag));
+                            return policy_type::end_message(hash, tag_mask, t.data(), t.size());
                         }
 
                     protected:
+                        inline void schedule_key() {
+                            block_type zero;
+                            std::memset(zero.data(), 0, sizeof(zero));
+                            const block_type H = cipher.encrypt(zero);
+
+                            typename hash_type::key_type key;
+                            std::memcpy(key.data(), H.data(), key.size());
+                            hash.set_key(key);
+                        }
+
                         template<typename AssociatedDataContainer>
                         inline void schedule_associated_data(const AssociatedDataContainer &iad) {
-                            m_ghash->set_associated_data(ad, ad_len);
+                            ad.assign(std::begin(iad), std::end(iad));
                         }
 
                         associated_data_type ad;
-                        nonce_type nonce;
 
                         cipher_type cipher;
+                        hash_type hash;
+                        typename policy_type::counter_type counter;
+                        block_type tag_mask;
                     };
                 }    // namespace detail
 
                 /*!
                  * @brief Galois/Counter Mode
                  *
-                 * @tparam BlockCipher
-                 * @tparam Padding
-                 * @tparam StreamCipher
-                 * @tparam Hash
+                 * NIST SP 800-38D. The counter mode keystream is generated several blocks at a time and
+                 * authenticated with GHASH. GCM is a stream mode, messages of any length are processed
+                 * without padding.
+                 *
+                 * @tparam BlockCipher 128-bit block cipher
+                 * @tparam TagBits Tag length, 96 to 128 bits
+                 * @tparam HashType Universal hash
                  */
-                template<typename BlockCipher, template<typename> class Padding, std::size_t TagBits = 16,
-
-                         typename HashType = hashes::ghash, typename StreamCipher = stream::ctr<BlockCipher>,
+                template<typename BlockCipher, std::size_t TagBits = 128, typename HashType = hashes::ghash,
                          template<typename> class Allocator = std::allocator>
                 struct gcm {
                     typedef BlockCipher cipher_type;
-                    typedef Padding<BlockCipher> padding_type;
-                    typedef StreamCipher stream_cipher_type;
                     typedef HashType hash_type;
 
                     template<typename T>
                     using allocator_type = Allocator<T>;
 
-                    typedef detail::gcm_encryption_policy<cipher_type, TagBits, padding_type, stream_cipher_type,
-                                                          hash_type, allocator_type>
+                    typedef detail::gcm_encryption_policy<cipher_type, TagBits, hash_type, allocator_type>
                         encryption_policy;
-                    typedef detail::gcm_decryption_policy<cipher_type, TagBits, padding_type, stream_cipher_type,
-                                                          hash_type, allocator_type>
+                    typedef detail::gcm_decryption_policy<cipher_type, TagBits, hash_type, allocator_type>
                         decryption_policy;
 
-                    template<template<typename, std::size_t, typename, typename, typename, template<typename> class>
-                             class PolicyType>
+                    template<template<typename, std::size_t, typename, template<typename> class> class PolicyType>
                     struct bind {
-                        typedef detail::gcm<
-                            PolicyType<cipher_type, TagBits, padding_type, stream_cipher_type, hash_type, allocator_type>>
-                            type;
+                        typedef detail::gcm<PolicyType<cipher_type, TagBits, hash_type, allocator_type>> type;
                     };
                 };
             }    // namespace modes
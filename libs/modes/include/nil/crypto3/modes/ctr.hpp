@@ -22,431 +22,174 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
-#ifndef CRYPTO3_BLOCK_MODE_CIPHER_BLOCK_CHAINING_HPP
-#define CRYPTO3_BLOCK_MODE_CIPHER_BLOCK_CHAINING_HPP
+#ifndef CRYPTO3_BLOCK_MODE_COUNTER_HPP
+#define CRYPTO3_BLOCK_MODE_COUNTER_HPP
 
-#include <boost/integer.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
 
-#include <nil/crypto3/modes/mode.hpp>
-#include <nil/crypto3/modes/cts.hpp>
-#include <nil/crypto3/modes/padding.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/endian/conversion.hpp>
 
-#include <nil/crypto3/codec/algorithm/encode.hpp>
-
-//#include <nil/crypto3/codec/logic.hpp>
+#include <nil/crypto3/block/detail/cipher_blocks.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace block {
             namespace modes {
                 namespace detail {
-                    template<typename Cipher, typename Padding, template<typename> class Allocator = std::allocator>
-                    struct ctr_policy {
-                        typedef std::size_t size_type;
-
+                    /*!
+                     * @brief Counter mode keystream over a 128-bit block cipher.
+                     *
+                     * The rightmost CounterBits of the counter block are incremented as a big-endian integer,
+                     * the rest of the block stays fixed. Counter blocks are encrypted batch_blocks at a time
+                     * through the cipher's encrypt_blocks when it has one, so that pipelined implementations
+                     * (AES-NI) stay busy. Unused keystream of a partial block is kept for the next call.
+                     */
+                    template<typename Cipher, std::size_t CounterBits = Cipher::block_bits>
+                    class ctr_keystream {
+                    public:
                         typedef Cipher cipher_type;
-                        typedef Padding padding_type;
-
-                        constexpr static const size_type block_bits = cipher_type::block_bits;
-                        constexpr static const size_type block_words = cipher_type::block_words;
                         typedef typename cipher_type::block_type block_type;
 
-                        typedef std::vector<boost::uint_t<CHAR_BIT>, Allocator<boost::uint_t<CHAR_BIT>>> iv_type;
-                    };
-
-                    template<typename Cipher, typename Padding, typename CiphertextStealingMode>
-                    struct ctr_encryption_policy : public ctr_policy<Cipher, Padding> {};
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_encryption_policy<Cipher, Padding, cts<0, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
+                        constexpr static const std::size_t block_bytes = 16;
+                        constexpr static const std::size_t batch_blocks = 8;
+                        constexpr static const std::size_t counter_bits = CounterBits;
 
-                        constexpr static const size_type block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
+                        BOOST_STATIC_ASSERT(sizeof(block_type) == block_bytes);
+                        BOOST_STATIC_ASSERT(counter_bits > 0 && counter_bits <= 128 && counter_bits % 8 == 0);
 
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, iv,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
+                        ctr_keystream() : position(block_bytes) {
                         }
 
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, previous,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const block_type &previous = block_type(),
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = {0};
-                            std::array<uint8_t, block_bits / CHAR_BIT> byte_array = {0};
-
-                            pack(plaintext, byte_array);
-
-                            size_type rem = std::count(byte_array.begin(), byte_array.end(), block_type::value_type()) %
-                                            (block_bits / CHAR_BIT);
-                            if (rem || padding_type::always_pad) {
-                                block_type padbuffer = padding_type::pad(plaintext, rem), block;
-                                //                            codec::encode<codec::encoder::logic_xor>(!iv.empty() ? iv
-                                //                            : previous, padbuffer, block .begin());
-                                result = cipher.encrypt(block);
-                            }
-
-                            return result;
+                        ~ctr_keystream() {
+                            std::memset(keystream.data(), 0, sizeof(keystream));
                         }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_encryption_policy<Cipher, Padding, cts<1, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, iv,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type block = {0};
 
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, previous,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
+                        /// Starts from the given counter block, the first keystream block is E(initial_counter).
+                        void reset(const block_type &initial_counter) {
+                            const std::uint8_t *c = reinterpret_cast<const std::uint8_t *>(initial_counter.data());
+                            counter_high = boost::endian::load_big_u64(c);
+                            counter_low = boost::endian::load_big_u64(c + 8);
+                            position = block_bytes;
                         }
 
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const block_type &previous = block_type(),
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = {0};
-                            std::array<uint8_t, block_bits / CHAR_BIT> byte_array = {0};
-
-                            pack(plaintext, byte_array);
-
-                            size_type rem = std::count(byte_array.begin(), byte_array.end(), block_type::value_type()) %
-                                            (block_bits / CHAR_BIT);
-                            if (rem || padding_type::always_pad) {
-                                block_type padbuffer = padding_type::pad(plaintext, rem), block;
-                                //                            codec::encode<codec::encoder::logic_xor>(!iv.empty() ? iv
-                                //                            : previous, padbuffer, block .begin());
-                                result = cipher.encrypt(block);
+                        /// Advances the counter by the given number of blocks without generating keystream.
+                        void skip(std::uint64_t blocks) {
+                            if (counter_bits < 64) {
+                                const std::uint64_t mask = (std::uint64_t(1) << (counter_bits % 64)) - 1;
+                                counter_low = (counter_low & ~mask) | ((counter_low + blocks) & mask);
+                            } else if (counter_bits == 64) {
+                                counter_low += blocks;
+                            } else {
+                                const std::uint64_t mask =
+                                    counter_bits == 128 ? ~std::uint64_t(0) :
+                                                          (std::uint64_t(1) << (counter_bits % 64)) - 1;
+                                const std::uint64_t low = counter_low + blocks;
+                                const std::uint64_t carry = low < counter_low ? 1 : 0;
+                                counter_low = low;
+                                counter_high = (counter_high & ~mask) | ((counter_high + carry) & mask);
                             }
-
-                            return result;
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_encryption_policy<Cipher, Padding, cts<2, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, iv,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, previous,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
                         }
 
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const block_type &previous = block_type(),
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = {0};
-                            std::array<uint8_t, block_bits / CHAR_BIT> byte_array = {0};
-
-                            pack(plaintext, byte_array);
-
-                            size_type rem = std::count(byte_array.begin(), byte_array.end(), block_type::value_type()) %
-                                            (block_bits / CHAR_BIT);
-                            if (rem || padding_type::always_pad) {
-                                block_type padbuffer = padding_type::pad(plaintext, rem), block;
-                                //                            codec::encode<codec::encoder::logic_xor>(!iv.empty() ? iv
-                                //                            : previous, padbuffer, block .begin());
-                                result = cipher.encrypt(block);
+                        /// XORs length bytes of keystream into in, in and out may be the same buffer.
+                        void apply(const cipher_type &cipher, const std::uint8_t *in, std::uint8_t *out,
+                                   std::size_t length) {
+                            const std::uint8_t *leftover = keystream[0].data();
+                            for (; length > 0 && position < block_bytes; length--) {
+                                *out++ = *in++ ^ leftover[position++];
                             }
 
-                            return result;
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_encryption_policy<Cipher, Padding, cts<3, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, iv,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type block = {0};
-
-                            //                        codec::encode<codec::encoder::logic_xor>(plaintext, previous,
-                            //                        block.begin());
-
-                            return cipher.encrypt(block);
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const block_type &previous = block_type(),
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = {0};
-                            std::array<uint8_t, block_bits / CHAR_BIT> byte_array = {0};
-
-                            pack(plaintext, byte_array);
-
-                            size_type rem = std::count(byte_array.begin(), byte_array.end(), block_type::value_type()) %
-                                            (block_bits / CHAR_BIT);
-                            if (rem || padding_type::always_pad) {
-                                block_type padbuffer = padding_type::pad(plaintext, rem), block;
-                                //                            codec::encode<codec::encoder::logic_xor>(!iv.empty() ? iv
-                                //                            : previous, padbuffer, block .begin());
-                                result = cipher.encrypt(block);
+                            while (length >= block_bytes) {
+                                const std::size_t n = std::min(length / block_bytes, batch_blocks);
+                                for (std::size_t i = 0; i < n; i++) {
+                                    next_counter_block(counters[i]);
+                                }
+                                block::detail::encrypt_blocks(cipher, counters.data(), keystream.data(), n);
+
+                                xor_blocks(in, out, n);
+                                in += n * block_bytes;
+                                out += n * block_bytes;
+                                length -= n * block_bytes;
                             }
 
-                            return result;
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding, typename CiphertextStealingMode>
-                    struct ctr_decryption_policy : public ctr_policy<Cipher, Padding> {};
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_decryption_policy<Cipher, Padding, cts<0, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const std::size_t block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const std::size_t block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(block, iv);
-
-                            return block;
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, previous);
-
-                            return result;
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, iv);
-
-                            return result;
+                            if (length > 0) {
+                                next_counter_block(counters[0]);
+                                keystream[0] = cipher.encrypt(counters[0]);
+                                for (position = 0; position < length; position++) {
+                                    out[position] = in[position] ^ leftover[position];
+                                }
+                            }
                         }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct ctr_decryption_policy<Cipher, Padding, cts<1, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const std::size_t block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const std::size_t block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
-
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = cipher.decrypt(plaintext);
 
-                            //                        codec::encode<codec::encoder::logic_xor>(block, iv);
-
-                            return block;
+                    private:
+                        // Word-wise, the byte pointers could alias the keystream and would block vectorization
+                        void xor_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t n) const {
+                            const std::uint8_t *ks = reinterpret_cast<const std::uint8_t *>(keystream.data());
+                            for (std::size_t i = 0; i < n * block_bytes; i += 8) {
+                                std::uint64_t x, k;
+                                std::memcpy(&x, in + i, 8);
+                                std::memcpy(&k, ks + i, 8);
+                                x ^= k;
+                                std::memcpy(out + i, &x, 8);
+                            }
                         }
 
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, previous);
-
-                            return result;
+                        void next_counter_block(block_type &block) {
+                            std::uint8_t *c = reinterpret_cast<std::uint8_t *>(block.data());
+                            boost::endian::store_big_u64(c, counter_high);
+                            boost::endian::store_big_u64(c + 8, counter_low);
+                            skip(1);
                         }
 
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, iv);
-
-                            return result;
-                        }
+                        std::uint64_t counter_high;
+                        std::uint64_t counter_low;
+                        std::array<block_type, batch_blocks> counters;
+                        std::array<block_type, batch_blocks> keystream;
+                        std::size_t position;
                     };
 
-                    template<typename Cipher, typename Padding>
-                    struct ctr_decryption_policy<Cipher, Padding, cts<2, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const std::size_t block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const std::size_t block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
+                    template<typename Cipher>
+                    struct ctr_policy {
+                        typedef std::size_t size_type;
 
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = cipher.decrypt(plaintext);
+                        typedef Cipher cipher_type;
 
-                            //                        codec::encode<codec::encoder::logic_xor>(block, iv);
+                        constexpr static const size_type block_bits = cipher_type::block_bits;
+                        constexpr static const size_type block_words = cipher_type::block_words;
+                        typedef typename cipher_type::block_type block_type;
 
-                            return block;
-                        }
+                        BOOST_STATIC_ASSERT(block_bits == 128);
 
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type result = cipher.decrypt(plaintext);
+                        typedef ctr_keystream<cipher_type> keystream_type;
 
-                            //                        codec::encode<codec::encoder::logic_xor>(result, previous);
+                        static void begin_message(keystream_type &keystream, const std::uint8_t *iv,
+                                                  std::size_t iv_bytes) {
+                            if (iv_bytes != sizeof(block_type)) {
+                                throw std::invalid_argument("CTR initial counter block must be one block long");
+                            }
 
-                            return result;
+                            block_type initial_counter;
+                            std::memcpy(initial_counter.data(), iv, sizeof(block_type));
+                            keystream.reset(initial_counter);
                         }
 
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, iv);
-
-                            return result;
+                        static void process(const cipher_type &cipher, keystream_type &keystream,
+                                            const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            keystream.apply(cipher, in, out, length);
                         }
                     };
 
-                    template<typename Cipher, typename Padding>
-                    struct ctr_decryption_policy<Cipher, Padding, cts<3, Cipher, Padding>>
-                        : public ctr_policy<Cipher, Padding> {
-                        typedef typename ctr_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename ctr_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const std::size_t block_bits = ctr_policy<Cipher, Padding>::block_bits;
-                        constexpr static const std::size_t block_words = ctr_policy<Cipher, Padding>::block_words;
-                        typedef typename ctr_policy<Cipher, Padding>::block_type block_type;
-
-                        typedef typename ctr_policy<Cipher, Padding>::iv_type iv_type;
+                    template<typename Cipher>
+                    struct ctr_encryption_policy : public ctr_policy<Cipher> { };
 
-                        inline static block_type begin_message(const cipher_type &cipher, const block_type &plaintext,
-                                                               const iv_type &iv = iv_type()) {
-                            block_type block = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(block, iv);
-
-                            return block;
-                        }
-
-                        inline static block_type process_block(const cipher_type &cipher, const block_type &plaintext,
-                                                               const block_type &previous = block_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, previous);
-
-                            return result;
-                        }
-
-                        inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext,
-                                                             const iv_type &iv = iv_type()) {
-                            block_type result = cipher.decrypt(plaintext);
-
-                            //                        codec::encode<codec::encoder::logic_xor>(result, iv);
-
-                            return result;
-                        }
-                    };
+                    template<typename Cipher>
+                    struct ctr_decryption_policy : public ctr_policy<Cipher> { };
 
                     template<typename PolicyType>
                     class counter {
@@ -454,12 +197,10 @@ namespace nil {
 
                     public:
                         typedef typename policy_type::cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
 
                         typedef typename policy_type::size_type size_type;
 
                         typedef typename cipher_type::key_type key_type;
-                        typedef typename policy_type::iv_type iv_type;
 
                         constexpr static const size_type block_bits = policy_type::block_bits;
                         constexpr static const size_type block_words = policy_type::block_words;
@@ -468,52 +209,51 @@ namespace nil {
                         counter(const cipher_type &cipher) : cipher(cipher) {
                         }
 
-                        block_type begin_message(const block_type &plaintext, const iv_type &iv = iv_type()) {
-                            previous = policy_type::begin_message(cipher, plaintext, iv);
-                            return previous;
+                        counter(const key_type &key) : cipher(key) {
                         }
 
-                        block_type process_block(const block_type &plaintext) {
-                            previous = policy_type::process_block(cipher, plaintext, previous);
-                            return previous;
+                        /// Starts a message from a full initial counter block.
+                        template<typename IvContainer>
+                        inline void begin_message(const IvContainer &iv) {
+                            const std::vector<std::uint8_t> i(std::begin(iv), std::end(iv));
+                            policy_type::begin_message(keystream, i.data(), i.size());
                         }
 
-                        block_type end_message(const block_type &plaintext, const iv_type &iv = iv_type()) {
-                            return policy_type::end_message(cipher, plaintext, iv);
+                        /// Encrypts or decrypts length bytes, in and out may be the same buffer.
+                        inline void process(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            policy_type::process(cipher, keystream, in, out, length);
                         }
 
                         inline static size_type required_output_size(size_type inputlen) {
-                            return padding_type::required_output_size(inputlen);
+                            return inputlen;
                         }
 
                     protected:
-                        block_type previous;
                         cipher_type cipher;
+                        typename policy_type::keystream_type keystream;
                     };
                 }    // namespace detail
 
                 /*!
                  * @brief Counter Mode (CTR).
-                 * @tparam Cipher
-                 * @tparam Padding
+                 *
+                 * NIST SP 800-38A with the whole counter block incremented as a big-endian integer. CTR is a
+                 * stream mode, messages of any length are processed without padding.
+                 *
+                 * @tparam Cipher 128-bit block cipher
                  *
                  * @ingroup block_modes
                  */
-                template<typename Cipher, template<typename> class Padding,
-                         template<typename, template<typename> class> class CiphertextStealingMode = cts0>
+                template<typename Cipher>
                 struct counter {
                     typedef Cipher cipher_type;
-                    typedef Padding<Cipher> padding_type;
-                    typedef CiphertextStealingMode<Cipher, Padding> ciphertext_stealing_type;
 
-                    typedef detail::ctr_encryption_policy<cipher_type, padding_type, ciphertext_stealing_type>
-                        encryption_policy;
-                    typedef detail::ctr_decryption_policy<cipher_type, padding_type, ciphertext_stealing_type>
-                        decryption_policy;
+                    typedef detail::ctr_encryption_policy<cipher_type> encryption_policy;
+                    typedef detail::ctr_decryption_policy<cipher_type> decryption_policy;
 
-                    template<template<typename, typename> class PolicyType>
+                    template<template<typename> class PolicyType>
                     struct bind {
-                        typedef detail::counter<PolicyType<cipher_type, padding_type>> type;
+                        typedef detail::counter<PolicyType<cipher_type>> type;
                     };
                 };
 
@@ -521,14 +261,11 @@ namespace nil {
                  * @brief
                  *
                  * @tparam Cipher
-                 * @tparam Padding
-                 * @tparam CiphertextStealingMode
                  *
                  * @ingroup block_modes
                  */
-                template<typename Cipher, template<typename> class Padding,
-                         template<typename, template<typename> class> class CiphertextStealingMode>
-                using ctr = counter<Cipher, Padding, CiphertextStealingMode>;
+                template<typename Cipher>
+                using ctr = counter<Cipher>;
             }    // namespace modes
         }        // namespace block
     }            // namespace crypto3
@@ -25,453 +25,261 @@
 #ifndef CRYPTO3_MODE_XTS_HPP
 #define CRYPTO3_MODE_XTS_HPP
 
-#include <memory>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
 
-#include <nil/crypto3/modes/cts.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/endian/conversion.hpp>
 
-#include <nil/crypto3/block/cipher.hpp>
+#include <nil/crypto3/block/detail/cipher_blocks.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace block {
             namespace modes {
                 namespace detail {
-                    template<typename Cipher, typename Padding, template<typename> class Allocator = std::allocator>
+                    template<typename Cipher>
                     struct xts_policy {
+                        typedef std::size_t size_type;
+
                         typedef Cipher cipher_type;
-                        typedef Padding padding_type;
 
-                        constexpr static const std::size_t block_bits = cipher_type::block_bits;
-                        constexpr static const std::size_t block_words = cipher_type::block_words;
+                        constexpr static const size_type block_bits = cipher_type::block_bits;
+                        constexpr static const size_type block_words = cipher_type::block_words;
                         typedef typename cipher_type::block_type block_type;
 
-                        constexpr static const std::size_t key_bits = cipher_type::key_bits;
-                        constexpr static const std::size_t key_words = cipher_type::key_words;
-                        typedef typename cipher_type::key_type key_type;
-
-                        static void update_tweak(const cipher_type &tweak_cipher, size_t which) {
-                            const size_t BS = tweak_cipher->block_size();
-
-                            if (which > 0) {
-                                poly_double_n_le(m_tweak.data(), &m_tweak[(which - 1) * BS], BS);
-                            }
-
-                            const size_t blocks_in_tweak = update_granularity() / BS;
-
-                            for (size_t i = 1; i < blocks_in_tweak; ++i) {
-                                poly_double_n_le(&m_tweak[i * BS], &m_tweak[(i - 1) * BS], BS);
-                            }
-                        }
-
-                        static void schedule_key(const key_type &key) {
-                            const size_t key_half = length / 2;
-
-                            if (length % 2 == 1 || !m_cipher->valid_keylength(key_half)) {
-                                throw invalid_key_length(name(), length);
-                            }
-
-                            m_cipher->set_key(key, key_half);
-                            m_tweak_cipher->set_key(&key[key_half], key_half);
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding, typename CiphertextStealingMode>
-                    struct xts_encryption_policy : public xts_policy<Cipher, Padding> {};
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_encryption_policy<Cipher, Padding, cts<0, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
-
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            if (!valid_nonce_length(nonce_len)) {
-                                throw invalid_iv_length(name(), nonce_len);
-                            }
-
-                            copy_mem(m_tweak.data(), nonce, nonce_len);
-                            m_tweak_cipher->encrypt(m_tweak.data());
-
-                            update_tweak(0);
-                        }
-
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            const size_t BS = cipher().block_size();
-
-                            BOOST_ASSERT_MSG(sz % BS == 0, "Input is full blocks");
-                            size_t blocks = sz / BS;
-
-                            const size_t blocks_in_tweak = update_granularity() / BS;
-
-                            while (blocks) {
-                                const size_t to_proc = std::min(blocks, blocks_in_tweak);
+                        constexpr static const size_type block_bytes = 16;
+                        constexpr static const size_type batch_blocks = 8;
 
-                                cipher().encrypt_n_xex(buf, tweak(), to_proc);
+                        BOOST_STATIC_ASSERT(block_bits == 128);
+                        BOOST_STATIC_ASSERT(sizeof(block_type) == block_bytes);
 
-                                buf += to_proc * BS;
-                                blocks -= to_proc;
-
-                                update_tweak(to_proc);
-                            }
-
-                            return sz;
+                        /// Multiplies the tweak by the primitive element of GF(2^128), little-endian convention
+                        static void multiply_alpha(block_type &tweak) {
+                            std::uint8_t *t = reinterpret_cast<std::uint8_t *>(tweak.data());
+                            const std::uint64_t low = boost::endian::load_little_u64(t);
+                            const std::uint64_t high = boost::endian::load_little_u64(t + 8);
+                            const std::uint64_t carry = high >> 63;
+                            boost::endian::store_little_u64(t, (low << 1) ^ (carry * 0x87));
+                            boost::endian::store_little_u64(t + 8, (high << 1) | (low >> 63));
                         }
 
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            BOOST_ASSERT_MSG(buffer.size() >= offset, "Offset is sane");
-                            const size_t sz = buffer.size() - offset;
-                            uint8_t *buf = buffer.data() + offset;
-
-                            BOOST_ASSERT_MSG(sz >= minimum_final_size(), "Have sufficient final input in XTS encipher");
-
-                            const size_t BS = cipher().block_size();
-
-                            if (sz % BS == 0) {
-                                update(buffer, offset);
-                            } else {
-                                // steal ciphertext
-                                const size_t full_blocks = ((sz / BS) - 1) * BS;
-                                const size_t final_bytes = sz - full_blocks;
-                                BOOST_ASSERT_MSG(final_bytes > BS && final_bytes < 2 * BS,
-                                                 "Left over size in expected range");
-
-                                secure_vector<uint8_t> last(buf + full_blocks, buf + full_blocks + final_bytes);
-                                buffer.resize(full_blocks + offset);
-                                update(buffer, offset);
-
-                                xor_buf(last, tweak(), BS);
-                                cipher().encrypt(last);
-                                xor_buf(last, tweak(), BS);
-
-                                for (size_t i = 0; i != final_bytes - BS; ++i) {
-                                    last[i] ^= last[i + BS];
-                                    last[i + BS] ^= last[i];
-                                    last[i] ^= last[i + BS];
+                        /*!
+                         * @brief Processes n whole blocks with consecutive tweaks, leaving the tweak of the
+                         * next block in tweak.
+                         *
+                         * The blocks are masked batch_blocks at a time and handed to the cipher together, so
+                         * that an interleaved encrypt_blocks/decrypt_blocks is used when the cipher has one.
+                         */
+                        template<typename BlockFunction>
+                        static void process_blocks(const BlockFunction &transform, block_type &tweak,
+                                                   const std::uint8_t *in, std::uint8_t *out, std::size_t n) {
+                            std::array<block_type, batch_blocks> tweaks, buffer;
+
+                            while (n > 0) {
+                                const std::size_t m = std::min(n, batch_blocks);
+                                for (std::size_t i = 0; i < m; i++) {
+                                    tweaks[i] = tweak;
+                                    multiply_alpha(tweak);
+                                    std::memcpy(buffer[i].data(), in + i * block_bytes, block_bytes);
                                 }
+                                xor_blocks(buffer.data(), tweaks.data(), m);
 
-                                xor_buf(last, tweak() + BS, BS);
-                                cipher().encrypt(last);
-                                xor_buf(last, tweak() + BS, BS);
-
-                                buffer += last;
-                            }
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_encryption_policy<Cipher, Padding, cts<1, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
-
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_encryption_policy<Cipher, Padding, cts<2, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
-
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_encryption_policy<Cipher, Padding, cts<3, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
-
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.encrypt(plaintext);
-                        }
-
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding, typename CiphertextStealingMode>
-                    struct xts_decryption_policy : public xts_policy<Cipher, Padding> {};
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_decryption_policy<Cipher, Padding, cts<0, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
-
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
+                                transform(buffer.data(), buffer.data(), m);
 
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+                                xor_blocks(buffer.data(), tweaks.data(), m);
+                                std::memcpy(out, buffer.data(), m * block_bytes);
 
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            if (!valid_nonce_length(nonce_len)) {
-                                throw invalid_iv_length(name(), nonce_len);
+                                in += m * block_bytes;
+                                out += m * block_bytes;
+                                n -= m;
                             }
-
-                            copy_mem(m_tweak.data(), nonce, nonce_len);
-                            m_tweak_cipher->encrypt(m_tweak.data());
-
-                            update_tweak(0);
                         }
 
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            BOOST_ASSERT_MSG(buffer.size() >= offset, "Offset is sane");
-                            const size_t sz = buffer.size() - offset;
-                            uint8_t *buf = buffer.data() + offset;
-
-                            BOOST_ASSERT_MSG(sz >= minimum_final_size(), "Have sufficient final input in XTS isomorphic_decryption_mode");
-
-                            const size_t BS = cipher.block_size();
-
-                            if (sz % BS == 0) {
-                                update(buffer, offset);
-                            } else {
-                                // steal ciphertext
-                                const size_t full_blocks = ((sz / BS) - 1) * BS;
-                                const size_t final_bytes = sz - full_blocks;
-                                BOOST_ASSERT_MSG(final_bytes > BS && final_bytes < 2 * BS, "Left over size in expected range");
-
-                                secure_vector<uint8_t> last(buf + full_blocks, buf + full_blocks + final_bytes);
-                                buffer.resize(full_blocks + offset);
-                                update(buffer, offset);
-
-                                xor_buf(last, tweak() + BS, BS);
-                                cipher.decrypt(last);
-                                xor_buf(last, tweak() + BS, BS);
-
-                                for (size_t i = 0; i != final_bytes - BS; ++i) {
-                                    last[i] ^= last[i + BS];
-                                    last[i + BS] ^= last[i];
-                                    last[i] ^= last[i + BS];
-                                }
-
-                                xor_buf(last, tweak(), BS);
-                                cipher.decrypt(last);
-                                xor_buf(last, tweak(), BS);
-
-                                buffer += last;
+                    protected:
+                        static void xor_blocks(block_type *blocks, const block_type *masks, std::size_t n) {
+                            std::uint8_t *b = reinterpret_cast<std::uint8_t *>(blocks);
+                            const std::uint8_t *m = reinterpret_cast<const std::uint8_t *>(masks);
+                            for (std::size_t i = 0; i < n * block_bytes; i += 8) {
+                                std::uint64_t x, k;
+                                std::memcpy(&x, b + i, 8);
+                                std::memcpy(&k, m + i, 8);
+                                x ^= k;
+                                std::memcpy(b + i, &x, 8);
                             }
                         }
+                    };
 
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            const size_t BS = cipher().block_size();
-
-                            BOOST_ASSERT_MSG(sz % BS == 0, "Input is full blocks");
-                            size_t blocks = sz / BS;
+                    template<typename Cipher>
+                    struct xts_encryption_policy : public xts_policy<Cipher> {
+                        typedef xts_policy<Cipher> policy_type;
 
-                            const size_t blocks_in_tweak = update_granularity() / BS;
+                        typedef typename policy_type::cipher_type cipher_type;
+                        typedef typename policy_type::block_type block_type;
 
-                            while (blocks) {
-                                const size_t to_proc = std::min(blocks, blocks_in_tweak);
+                        constexpr static const std::size_t block_bytes = policy_type::block_bytes;
 
-                                cipher().encrypt_n_xex(buf, tweak(), to_proc);
+                        /// Encrypts a data unit, a trailing partial block is handled with ciphertext stealing
+                        static void process(const cipher_type &cipher, block_type &tweak, const std::uint8_t *in,
+                                            std::uint8_t *out, std::size_t length) {
+                            const auto transform = [&cipher](const block_type *i, block_type *o, std::size_t n) {
+                                block::detail::encrypt_blocks(cipher, i, o, n);
+                            };
 
-                                buf += to_proc * BS;
-                                blocks -= to_proc;
+                            const std::size_t tail = length % block_bytes;
+                            const std::size_t blocks = length / block_bytes;
 
-                                update_tweak(to_proc);
+                            if (tail == 0) {
+                                policy_type::process_blocks(transform, tweak, in, out, blocks);
+                                return;
                             }
 
-                            return sz;
-                        }
-                    };
-
-                    template<typename Cipher, typename Padding>
-                    struct xts_decryption_policy<Cipher, Padding, cts<1, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
+                            policy_type::process_blocks(transform, tweak, in, out, blocks - 1);
+                            in += (blocks - 1) * block_bytes;
+                            out += (blocks - 1) * block_bytes;
 
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
+                            std::array<std::uint8_t, 2 * block_bytes> last;
+                            policy_type::process_blocks(transform, tweak, in, last.data(), 1);
 
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+                            // The partial block is padded with the stolen tail of the previous ciphertext block
+                            std::memcpy(last.data() + block_bytes, last.data(), tail);
+                            std::memcpy(last.data(), in + block_bytes, tail);
+                            policy_type::process_blocks(transform, tweak, last.data(), last.data(), 1);
 
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
-
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
-
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
+                            std::memcpy(out, last.data(), block_bytes + tail);
                         }
                     };
 
-                    template<typename Cipher, typename Padding>
-                    struct xts_decryption_policy<Cipher, Padding, cts<2, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
+                    template<typename Cipher>
+                    struct xts_decryption_policy : public xts_policy<Cipher> {
+                        typedef xts_policy<Cipher> policy_type;
 
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
-
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+                        typedef typename policy_type::cipher_type cipher_type;
+                        typedef typename policy_type::block_type block_type;
 
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
+                        constexpr static const std::size_t block_bytes = policy_type::block_bytes;
 
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
+                        /// Decrypts a data unit, a trailing partial block is handled with ciphertext stealing
+                        static void process(const cipher_type &cipher, block_type &tweak, const std::uint8_t *in,
+                                            std::uint8_t *out, std::size_t length) {
+                            const auto transform = [&cipher](const block_type *i, block_type *o, std::size_t n) {
+                                block::detail::decrypt_blocks(cipher, i, o, n);
+                            };
 
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
-                        }
-                    };
+                            const std::size_t tail = length % block_bytes;
+                            const std::size_t blocks = length / block_bytes;
 
-                    template<typename Cipher, typename Padding>
-                    struct xts_decryption_policy<Cipher, Padding, cts<3, Cipher, Padding>>
-                        : public xts_policy<Cipher, Padding> {
-                        typedef typename xts_policy<Cipher, Padding>::size_type size_type;
+                            if (tail == 0) {
+                                policy_type::process_blocks(transform, tweak, in, out, blocks);
+                                return;
+                            }
 
-                        typedef typename xts_policy<Cipher, Padding>::cipher_type cipher_type;
-                        typedef typename xts_policy<Cipher, Padding>::padding_type padding_type;
+                            policy_type::process_blocks(transform, tweak, in, out, blocks - 1);
+                            in += (blocks - 1) * block_bytes;
+                            out += (blocks - 1) * block_bytes;
 
-                        constexpr static const size_type block_bits = xts_policy<Cipher, Padding>::block_bits;
-                        constexpr static const size_type block_words = xts_policy<Cipher, Padding>::block_words;
-                        typedef typename xts_policy<Cipher, Padding>::block_type block_type;
+                            // The last full ciphertext block was produced with the tweak that comes after its own
+                            block_type previous_tweak = tweak;
+                            policy_type::multiply_alpha(tweak);
 
-                        block_type begin_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
+                            std::array<std::uint8_t, 2 * block_bytes> last;
+                            policy_type::process_blocks(transform, tweak, in, last.data(), 1);
 
-                        block_type process_block(const cipher_type &cipher, const block_type &plaintext) {
-                            return cipher.decrypt(plaintext);
-                        }
+                            std::memcpy(last.data() + block_bytes, last.data(), tail);
+                            std::memcpy(last.data(), in + block_bytes, tail);
+                            policy_type::process_blocks(transform, previous_tweak, last.data(), last.data(), 1);
 
-                        block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
-                            return {};
+                            std::memcpy(out, last.data(), block_bytes + tail);
                         }
                     };
 
-                    // Electronic Code Book CodecMode (ECB)
                     template<typename PolicyType>
                     class xts {
                         typedef PolicyType policy_type;
 
                     public:
                         typedef typename policy_type::cipher_type cipher_type;
-                        typedef typename policy_type::padding_type padding_type;
 
                         typedef typename policy_type::size_type size_type;
 
-                        constexpr static const std::size_t block_bits = policy_type::block_bits;
-                        constexpr static const std::size_t block_words = policy_type::block_words;
+                        typedef typename cipher_type::key_type key_type;
+
+                        constexpr static const size_type block_bits = policy_type::block_bits;
+                        constexpr static const size_type block_words = policy_type::block_words;
                         typedef typename cipher_type::block_type block_type;
 
-                        xts(const cipher_type &c) : cipher(c) {
+                        xts(const cipher_type &data_cipher, const cipher_type &tweak_cipher) :
+                            cipher(data_cipher), tweak_cipher(tweak_cipher) {
                         }
 
-                        block_type begin_message(const block_type &plaintext) {
-                            return policy_type::begin_message(cipher, plaintext);
+                        xts(const key_type &data_key, const key_type &tweak_key) :
+                            cipher(data_key), tweak_cipher(tweak_key) {
                         }
 
-                        block_type process_block(const block_type &plaintext) {
-                            return policy_type::process_block(cipher, plaintext);
-                        }
+                        /*!
+                         * @brief Encrypts or decrypts one data unit of at least one block, in and out may be
+                         * the same buffer.
+                         * @param tweak 128-bit tweak value of the data unit
+                         */
+                        inline void process(const block_type &tweak, const std::uint8_t *in, std::uint8_t *out,
+                                            std::size_t length) {
+                            if (length < sizeof(block_type)) {
+                                throw std::invalid_argument("XTS data unit must be at least one block long");
+                            }
 
-                        block_type end_message(const block_type &plaintext) {
-                            return policy_type::end_message(cipher, plaintext);
+                            block_type t = tweak_cipher.encrypt(tweak);
+                            policy_type::process(cipher, t, in, out, length);
                         }
 
-                        size_type required_output_size(size_type inputlen) const {
-                            return padding_type::required_output_size(inputlen, block_size);
+                        /// Same as above with the data unit sequence number as the tweak value
+                        inline void process(std::uint64_t data_unit, const std::uint8_t *in, std::uint8_t *out,
+                                            std::size_t length) {
+                            block_type tweak;
+                            std::uint8_t *t = reinterpret_cast<std::uint8_t *>(tweak.data());
+                            for (std::size_t i = 0; i < sizeof(block_type); i++) {
+                                t[i] = i < 8 ? static_cast<std::uint8_t>(data_unit >> (8 * i)) : 0;
+                            }
+                            process(tweak, in, out, length);
                         }
 
-                        constexpr static const std::size_t key_length = cipher_type::key_length / 8;
-                        constexpr static const std::size_t block_size = cipher_type::block_size / 8;
+                        inline static size_type required_output_size(size_type inputlen) {
+                            return inputlen;
+                        }
 
-                    private:
-                        cipher_type cipher, tweak_cipher;
+                    protected:
+                        cipher_type cipher;
+                        cipher_type tweak_cipher;
                     };
                 }    // namespace detail
 
                 /*!
-                 * @brief IEEE P1619 XTS Mode
-                 * @tparam Cipher
-                 * @tparam Padding
-                 * @tparam CiphertextStealingMode
+                 * @brief XEX-based tweaked-codebook mode with ciphertext stealing (XTS).
+                 *
+                 * IEEE 1619 / NIST SP 800-38E. Each data unit is processed independently under its own
+                 * tweak, data units which are not a multiple of the block length use ciphertext stealing.
+                 *
+                 * @tparam Cipher 128-bit block cipher
                  *
                  * @ingroup block_modes
                  */
-                template<typename Cipher, template<typename> class Padding,
-                         template<typename, typename> class CiphertextStealingMode = cts0>
+                template<typename Cipher>
                 struct xts {
                     typedef Cipher cipher_type;
-                    typedef Padding<Cipher> padding_type;
-                    typedef CiphertextStealingMode<Cipher, Padding<Cipher>> ciphertext_stealing_type;
 
-                    typedef detail::xts_encryption_policy<cipher_type, padding_type, ciphertext_stealing_type>
-                        encryption_policy;
-                    typedef detail::xts_decryption_policy<cipher_type, padding_type, ciphertext_stealing_type>
-                        decryption_policy;
+                    typedef detail::xts_encryption_policy<cipher_type> encryption_policy;
+                    typedef detail::xts_decryption_policy<cipher_type> decryption_policy;
 
-                    template<template<typename, typename> class PolicyType>
+                    template<template<typename> class PolicyType>
                     struct bind {
-                        typedef detail::xts<PolicyType<cipher_type, padding_type>> type;
+                        typedef detail::xts<PolicyType<cipher_type>> type;
                     };
                 };
             }    // namespace modes
         }        // namespace block
-    }    // namespace crypto3
+    }            // namespace crypto3
 }    // namespace nil
 
-#endif
+#endif    // CRYPTO3_MODE_XTS_HPP
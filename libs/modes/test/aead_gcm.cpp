@@ -25,16 +25,183 @@
 
 #define BOOST_TEST_MODULE aead_gcm_test
 
-#include <nil/crypto3/modes/aead/gcm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <nil/crypto3/block/rijndael.hpp>
+
+#include <nil/crypto3/modes/aead/gcm.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::block;
+
+namespace {
+    std::vector<std::uint8_t> from_hex(const std::string &hex) {
+        std::vector<std::uint8_t> result(hex.size() / 2);
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return result;
+    }
+
+    // Test vectors from "The Galois/Counter Mode of Operation (GCM)", McGrew and Viega, as referenced by NIST
+    struct gcm_test_vector {
+        std::string key;
+        std::string plaintext;
+        std::string associated_data;
+        std::string nonce;
+        std::string ciphertext;
+        std::string tag;
+    };
+
+    const std::string p_60 =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657"
+        "ba637b39";
+    const std::string p_64 = p_60 + "1aafd255";
+    const std::string ad_20 = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+    const std::string k_128 = "feffe9928665731c6d6a8f9467308308";
+
+    const std::vector<gcm_test_vector> aes_128_vectors = {
+        {"00000000000000000000000000000000", "", "", "000000000000000000000000", "",
+         "58e2fccefa7e3061367f1d57a4e7455a"},
+        {"00000000000000000000000000000000", "00000000000000000000000000000000", "", "000000000000000000000000",
+         "0388dace60b6a392f328c2b971b2fe78", "ab6e47d42cec13bdf53a67b21257bddf"},
+        {k_128, p_64, "", "cafebabefacedbaddecaf888",
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac97"
+         "3d58e091473f5985",
+         "4d5c2af327cd64a62cf35abd2ba6fab4"},
+        {k_128, p_60, ad_20, "cafebabefacedbaddecaf888",
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac97"
+         "3d58e091",
+         "5bc94fbc3221a5db94fae95ae7121a47"},
+        {k_128, p_60, ad_20, "cafebabefacedbad",
+         "61353b4c2806934a777ff51fa22a4755699b2a714fcdc6f83766e5f97b6c742373806900e49f24b22b097544d4896b424989b5e1ebac0f07"
+         "c23f4598",
+         "3612d2e79e3b0785561be14aaca2fccb"},
+        {k_128, p_60, ad_20,
+         "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2a318a728c3c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57"
+         "a637b39b",
+         "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3cca7e2ca701e4a9a4fba43c90ccdcb281d48c7c6fd62875d2aca41703"
+         "4c34aee5",
+         "619cc5aefffe0bfa462af43c1699d050"}};
+
+    const std::vector<gcm_test_vector> aes_192_vectors = {
+        {k_128 + "feffe9928665731c", p_60, ad_20, "cafebabefacedbaddecaf888",
+         "3980ca0b3c00e841eb06fac4872a2757859e1ceaa6efd984628593b40ca1e19c7d773d00c144c525ac619d18c84a3f4718e2448b2fe324d9"
+         "ccda2710",
+         "2519498e80f1478f37ba55bd6d27618c"}};
+
+    const std::vector<gcm_test_vector> aes_256_vectors = {
+        {"0000000000000000000000000000000000000000000000000000000000000000", "", "", "000000000000000000000000", "",
+         "530f8afbc74536b9a963b4f1c4cb738b"},
+        {"0000000000000000000000000000000000000000000000000000000000000000", "00000000000000000000000000000000", "",
+         "000000000000000000000000", "cea7403d4d606b6e074ec5d3baf39d18", "d0d1c8a799996bf0265b98b5d48ab919"},
+        {k_128 + k_128, p_60, ad_20, "cafebabefacedbaddecaf888",
+         "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0a"
+         "bcc9f662",
+         "76fc6ece0f4e1768cddf8853bb2d551b"}};
+
+    template<std::size_t KeyBits>
+    typename rijndael<KeyBits, 128>::key_type make_key(const std::string &hex) {
+        const std::vector<std::uint8_t> bytes = from_hex(hex);
+        typename rijndael<KeyBits, 128>::key_type key {};
+        std::copy(bytes.begin(), bytes.end(), key.begin());
+        return key;
+    }
+
+    // Feeds the message in chunks of chunk_size bytes to exercise the partial block handling
+    template<typename Mode>
+    std::vector<std::uint8_t> process_chunked(Mode &mode, const std::vector<std::uint8_t> &input,
+                                              std::size_t chunk_size) {
+        std::vector<std::uint8_t> output(input.size());
+        for (std::size_t offset = 0; offset < input.size(); offset += chunk_size) {
+            const std::size_t n = std::min(chunk_size, input.size() - offset);
+            mode.process(input.data() + offset, output.data() + offset, n);
+        }
+        return output;
+    }
+
+    template<std::size_t KeyBits>
+    void check_gcm_vector(const gcm_test_vector &v) {
+        typedef rijndael<KeyBits, 128> cipher_type;
+        typedef modes::gcm<cipher_type> mode_type;
+        typedef typename mode_type::template bind<modes::detail::gcm_encryption_policy>::type encryption_type;
+        typedef typename mode_type::template bind<modes::detail::gcm_decryption_policy>::type decryption_type;
+
+        const std::vector<std::uint8_t> plaintext = from_hex(v.plaintext), ciphertext = from_hex(v.ciphertext),
+                                        tag = from_hex(v.tag), nonce = from_hex(v.nonce);
+
+        for (std::size_t chunk_size : {std::size_t(1), std::size_t(7), std::size_t(16), std::size_t(1024)}) {
+            encryption_type enc(make_key<KeyBits>(v.key), from_hex(v.associated_data));
+            enc.begin_message(nonce);
+            BOOST_CHECK(process_chunked(enc, plaintext, chunk_size) == ciphertext);
+            const typename encryption_type::tag_type computed_tag = enc.end_message();
+            BOOST_CHECK(std::vector<std::uint8_t>(computed_tag.begin(), computed_tag.end()) == tag);
+
+            decryption_type dec(make_key<KeyBits>(v.key), from_hex(v.associated_data));
+            dec.begin_message(nonce);
+            BOOST_CHECK(process_chunked(dec, ciphertext, chunk_size) == plaintext);
+            BOOST_CHECK(dec.end_message(tag));
+        }
+    }
+}    // namespace
+
 BOOST_AUTO_TEST_SUITE(gcm_mode_test_suite)
 
-    BOOST_AUTO_TEST_CASE(gcm_mode_test_case) {
+BOOST_AUTO_TEST_CASE(gcm_aes_128_test_vectors) {
+    for (const gcm_test_vector &v : aes_128_vectors) {
+        check_gcm_vector<128>(v);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gcm_aes_192_test_vectors) {
+    for (const gcm_test_vector &v : aes_192_vectors) {
+        check_gcm_vector<192>(v);
+    }
+}
 
+BOOST_AUTO_TEST_CASE(gcm_aes_256_test_vectors) {
+    for (const gcm_test_vector &v : aes_256_vectors) {
+        check_gcm_vector<256>(v);
     }
+}
+
+BOOST_AUTO_TEST_CASE(gcm_long_message_roundtrip) {
+    typedef modes::gcm<rijndael<128, 128>> mode_type;
+    typedef mode_type::bind<modes::detail::gcm_encryption_policy>::type encryption_type;
+    typedef mode_type::bind<modes::detail::gcm_decryption_policy>::type decryption_type;
+
+    // Long enough to go through whole eight-block batches, with a tail
+    std::vector<std::uint8_t> message(16 * 8 * 5 + 13);
+    for (std::size_t i = 0; i < message.size(); i++) {
+        message[i] = static_cast<std::uint8_t>(i * 31 + 7);
+    }
+    const std::vector<std::uint8_t> ad = from_hex(ad_20), nonce = from_hex("cafebabefacedbaddecaf888");
+
+    encryption_type enc(make_key<128>(k_128), ad);
+    enc.begin_message(nonce);
+    const std::vector<std::uint8_t> one_shot = process_chunked(enc, message, message.size());
+    const encryption_type::tag_type tag = enc.end_message();
+
+    enc.begin_message(nonce);
+    BOOST_CHECK(process_chunked(enc, message, 37) == one_shot);
+    BOOST_CHECK(enc.end_message() == tag);
+
+    decryption_type dec(make_key<128>(k_128), ad);
+    dec.begin_message(nonce);
+    BOOST_CHECK(process_chunked(dec, one_shot, 100) == message);
+    BOOST_CHECK(dec.end_message(tag));
+
+    std::vector<std::uint8_t> tampered = one_shot;
+    tampered[tampered.size() / 2] ^= 1;
+    dec.begin_message(nonce);
+    process_chunked(dec, tampered, tampered.size());
+    BOOST_CHECK(!dec.end_message(tag));
+}
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE mode_gcm_throughput_bench_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/block/rijndael.hpp>
+
+#include <nil/crypto3/hash/ghash.hpp>
+
+#include <nil/crypto3/modes/aead/gcm.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::block;
+
+std::vector<std::uint8_t> from_hex(const std::string &hex) {
+    std::vector<std::uint8_t> result(hex.size() / 2);
+    for (std::size_t i = 0; i < result.size(); i++) {
+        result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return result;
+}
+
+std::vector<std::uint8_t> generate_message(std::size_t size) {
+    std::mt19937 gen(0x5eed);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<std::uint8_t> message(size);
+    for (auto &byte : message) {
+        byte = static_cast<std::uint8_t>(distrib(gen));
+    }
+    return message;
+}
+
+double get_sec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(timepoint.time_since_epoch()).count();
+}
+
+template<std::size_t KeyBits>
+typename rijndael<KeyBits, 128>::key_type make_key(const std::string &hex) {
+    const std::vector<std::uint8_t> bytes = from_hex(hex);
+    typename rijndael<KeyBits, 128>::key_type key {};
+    std::copy(bytes.begin(), bytes.end(), key.begin());
+    return key;
+}
+
+// The benchmarked configuration has to reproduce the McGrew-Viega test vector first
+template<std::size_t KeyBits>
+void print_throughput_csv(const char *name, const std::string &key_hex, const std::string &expected_ciphertext,
+                          const std::string &expected_tag) {
+    typedef typename modes::gcm<rijndael<KeyBits, 128>>::template bind<modes::detail::gcm_encryption_policy>::type
+        encryption_type;
+
+    const std::vector<std::uint8_t> plaintext = from_hex(
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a721c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657"
+        "ba637b39");
+    const std::vector<std::uint8_t> ad = from_hex("feedfacedeadbeeffeedfacedeadbeefabaddad2"),
+                                    nonce = from_hex("cafebabefacedbaddecaf888");
+
+    encryption_type enc(make_key<KeyBits>(key_hex), ad);
+    enc.begin_message(nonce);
+    std::vector<std::uint8_t> ciphertext(plaintext.size());
+    enc.process(plaintext.data(), ciphertext.data(), plaintext.size());
+    const typename encryption_type::tag_type tag = enc.end_message();
+    BOOST_CHECK(ciphertext == from_hex(expected_ciphertext));
+    BOOST_CHECK(std::vector<std::uint8_t>(tag.begin(), tag.end()) == from_hex(expected_tag));
+
+    const std::size_t total_bytes = std::size_t(1) << 28;
+
+    printf("%s\nmessage, bytes\tgcm encryption, MB/s\tghash, MB/s\n", name);
+    for (std::size_t size : {std::size_t(64), std::size_t(1) << 10, std::size_t(1) << 20}) {
+        std::vector<std::uint8_t> message = generate_message(size);
+        const std::size_t iterations = total_bytes / size;
+        const double megabytes = double(iterations * size) / (1 << 20);
+
+        double start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            enc.begin_message(nonce);
+            enc.process(message.data(), message.data(), message.size());
+            enc.end_message();
+        }
+        double gcm_time = get_sec_time() - start_time;
+
+        hashes::ghash ghash(hashes::ghash::key_type {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+        start_time = get_sec_time();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            ghash.update(message.data(), message.size());
+            ghash.final();
+        }
+        double ghash_time = get_sec_time() - start_time;
+
+        printf("%zu\t%.1f\t%.1f\n", size, megabytes / gcm_time, megabytes / ghash_time);
+        fflush(stdout);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(gcm_throughput_bench)
+
+BOOST_AUTO_TEST_CASE(gcm_aes_128_throughput_bench) {
+    print_throughput_csv<128>("gcm<rijndael<128, 128>>", "feffe9928665731c6d6a8f9467308308",
+                              "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e21d514b25466931c7d8f6a5a"
+                              "ac84aa051ba30b396a0aac973d58e091",
+                              "5bc94fbc3221a5db94fae95ae7121a47");
+}
+
+BOOST_AUTO_TEST_CASE(gcm_aes_256_throughput_bench) {
+    print_throughput_csv<256>("gcm<rijndael<256, 128>>",
+                              "feffe9928665731c6d6a8f9467308308feffe9928665731c6d6a8f9467308308",
+                              "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa8cb08e48590dbb3da7b08b10"
+                              "56828838c5f61e6393ba7a0abcc9f662",
+                              "76fc6ece0f4e1768cddf8853bb2d551b");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
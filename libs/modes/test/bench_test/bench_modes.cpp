@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE mode_throughput_bench_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <nil/crypto3/block/rijndael.hpp>
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+
+#include <nil/crypto3/modes/ctr.hpp>
+#include <nil/crypto3/modes/xts.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::block;
+
+std::vector<std::uint8_t> from_hex(const std::string &hex) {
+    std::vector<std::uint8_t> result(hex.size() / 2);
+    for (std::size_t i = 0; i < result.size(); i++) {
+        result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return result;
+}
+
+std::vector<std::uint8_t> generate_message(std::size_t size) {
+    std::mt19937 gen(0x5eed);
+    std::uniform_int_distribution<unsigned> distrib(0, 255);
+
+    std::vector<std::uint8_t> message(size);
+    for (auto &byte : message) {
+        byte = static_cast<std::uint8_t>(distrib(gen));
+    }
+    return message;
+}
+
+double get_sec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double>(timepoint.time_since_epoch()).count();
+}
+
+template<typename Cipher>
+typename Cipher::key_type make_key(std::uint8_t seed) {
+    typename Cipher::key_type key {};
+    for (std::size_t i = 0; i < key.size(); i++) {
+        key[i] = static_cast<std::uint8_t>(seed + i);
+    }
+    return key;
+}
+
+template<typename Function>
+double megabytes_per_second(std::size_t size, std::size_t iterations, const Function &f) {
+    const double start_time = get_sec_time();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        f();
+    }
+    return double(iterations * size) / (1 << 20) / (get_sec_time() - start_time);
+}
+
+// The benchmarked configurations have to reproduce the SP 800-38A and IEEE 1619 test vectors first
+void check_vectors() {
+    typedef rijndael<128, 128> cipher_type;
+
+    const std::vector<std::uint8_t> key = from_hex("2b7e151628aed2a6abf7158809cf4f3c");
+    cipher_type::key_type ctr_key;
+    std::copy(key.begin(), key.end(), ctr_key.begin());
+    modes::counter<cipher_type>::bind<modes::detail::ctr_encryption_policy>::type ctr(ctr_key);
+    std::vector<std::uint8_t> block = from_hex("6bc1bee22e409f96e93d7e117393172a");
+    ctr.begin_message(from_hex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"));
+    ctr.process(block.data(), block.data(), block.size());
+    BOOST_CHECK(block == from_hex("874d6191b620e3261bef6864990db6ce"));
+
+    cipher_type::key_type key1, key2;
+    key1.fill(0x11);
+    key2.fill(0x22);
+    modes::xts<cipher_type>::bind<modes::detail::xts_encryption_policy>::type xts(key1, key2);
+    std::vector<std::uint8_t> unit(32, 0x44);
+    xts.process(0x3333333333, unit.data(), unit.data(), unit.size());
+    BOOST_CHECK(unit == from_hex("c454185e6a16936e39334038acef838bfb186fff7480adc4289382ecd6d394f0"));
+}
+
+template<std::size_t KeyBits>
+void print_throughput_csv(const char *name) {
+    typedef rijndael<KeyBits, 128> cipher_type;
+    typedef typename cipher_type::block_type block_type;
+    typedef typename modes::counter<cipher_type>::template bind<modes::detail::ctr_encryption_policy>::type
+        ctr_type;
+    typedef typename modes::xts<cipher_type>::template bind<modes::detail::xts_encryption_policy>::type xts_type;
+
+    const cipher_type cipher(make_key<cipher_type>(1));
+    ctr_type ctr(cipher);
+    xts_type xts(cipher, cipher_type(make_key<cipher_type>(2)));
+    const std::vector<std::uint8_t> iv(16, 0);
+
+    const std::size_t total_bytes = std::size_t(1) << 26;
+
+    printf("%s\nmessage, bytes\tecb block by block, MB/s\tecb encrypt_blocks, MB/s\tecb encrypt<>, MB/s\t"
+           "ctr, MB/s\txts, MB/s\n",
+           name);
+    for (std::size_t size : {std::size_t(512), std::size_t(1) << 12, std::size_t(1) << 20}) {
+        std::vector<std::uint8_t> message = generate_message(size);
+        std::vector<block_type> blocks(size / sizeof(block_type));
+        for (std::size_t i = 0; i < blocks.size(); i++) {
+            std::copy(message.begin() + i * sizeof(block_type), message.begin() + (i + 1) * sizeof(block_type),
+                      blocks[i].begin());
+        }
+        const std::size_t iterations = total_bytes / size;
+
+        const double ecb_single = megabytes_per_second(size, iterations, [&]() {
+            for (auto &b : blocks) {
+                b = cipher.encrypt(b);
+            }
+        });
+        const double ecb_blocks = megabytes_per_second(
+            size, iterations, [&]() { cipher.encrypt_blocks(blocks.data(), blocks.data(), blocks.size()); });
+        const double ecb_algorithm = megabytes_per_second(size, iterations / 8, [&]() {
+            std::vector<std::uint8_t> out = encrypt<cipher_type>(message, make_key<cipher_type>(1));
+            message[0] ^= out[0];
+        });
+        const double ctr_speed = megabytes_per_second(size, iterations, [&]() {
+            ctr.begin_message(iv);
+            ctr.process(message.data(), message.data(), message.size());
+        });
+        std::uint64_t data_unit = 0;
+        const double xts_speed = megabytes_per_second(
+            size, iterations, [&]() { xts.process(data_unit++, message.data(), message.data(), message.size()); });
+
+        printf("%zu\t%.1f\t%.1f\t%.1f\t%.1f\t%.1f\n", size, ecb_single, ecb_blocks, ecb_algorithm, ctr_speed,
+               xts_speed);
+        fflush(stdout);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(modes_throughput_bench)
+
+BOOST_AUTO_TEST_CASE(modes_aes_128_throughput_bench) {
+    check_vectors();
+    print_throughput_csv<128>("rijndael<128, 128>");
+}
+
+BOOST_AUTO_TEST_CASE(modes_aes_256_throughput_bench) {
+    print_throughput_csv<256>("rijndael<256, 128>");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,21 +22,111 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //---------------------------------------------------------------------------//
-
 #define BOOST_TEST_MODULE ctr_test
 
-#include <nil/crypto3/modes/ctr.hpp>
-
-#include <nil/crypto3/modes/algorithm/encrypt.hpp>
-#include <nil/crypto3/modes/algorithm/decrypt.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
+#include <nil/crypto3/block/rijndael.hpp>
+
+#include <nil/crypto3/modes/ctr.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::block;
+
+namespace {
+    std::vector<std::uint8_t> from_hex(const std::string &hex) {
+        std::vector<std::uint8_t> result(hex.size() / 2);
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return result;
+    }
+
+    template<std::size_t KeyBits>
+    typename rijndael<KeyBits, 128>::key_type make_key(const std::string &hex) {
+        const std::vector<std::uint8_t> bytes = from_hex(hex);
+        typename rijndael<KeyBits, 128>::key_type key {};
+        std::copy(bytes.begin(), bytes.end(), key.begin());
+        return key;
+    }
+
+    template<std::size_t KeyBits>
+    void check_ctr(const std::string &key, const std::string &iv, const std::vector<std::uint8_t> &plaintext,
+                   const std::string &ciphertext) {
+        typedef rijndael<KeyBits, 128> cipher_type;
+        typedef modes::counter<cipher_type> mode_type;
+        typedef typename mode_type::template bind<modes::detail::ctr_encryption_policy>::type encryption_type;
+        typedef typename mode_type::template bind<modes::detail::ctr_decryption_policy>::type decryption_type;
+
+        const std::vector<std::uint8_t> expected = from_hex(ciphertext);
+
+        // Chunks smaller than a block, unaligned ones and ones larger than a batch of blocks
+        for (std::size_t chunk_size : {std::size_t(1), std::size_t(7), std::size_t(16), std::size_t(1024)}) {
+            encryption_type enc(make_key<KeyBits>(key));
+            decryption_type dec(make_key<KeyBits>(key));
+            enc.begin_message(from_hex(iv));
+            dec.begin_message(from_hex(iv));
+
+            std::vector<std::uint8_t> out(plaintext.size()), back(plaintext.size());
+            for (std::size_t offset = 0; offset < plaintext.size(); offset += chunk_size) {
+                const std::size_t n = std::min(chunk_size, plaintext.size() - offset);
+                enc.process(plaintext.data() + offset, out.data() + offset, n);
+                dec.process(out.data() + offset, back.data() + offset, n);
+            }
+
+            BOOST_CHECK(out == expected);
+            BOOST_CHECK(back == plaintext);
+        }
+    }
+
+    const std::string sp_800_38a_plaintext =
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e5130c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b"
+        "17ad2b417be66c3710";
+}    // namespace
+
 BOOST_AUTO_TEST_SUITE(ctr_mode_test_suite)
 
-BOOST_AUTO_TEST_CASE(ctr_mode_test_case) {
+// NIST SP 800-38A F.5.1, F.5.3, F.5.5
+BOOST_AUTO_TEST_CASE(ctr_aes_128) {
+    check_ctr<128>("2b7e151628aed2a6abf7158809cf4f3c", "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+                   from_hex(sp_800_38a_plaintext),
+                   "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff5ae4df3edbd5d35e5b4f09020db03eab1e"
+                   "031dda2fbe03d1792170a0f3009cee");
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes_192) {
+    check_ctr<192>("8e73b0f7da0e6452c810f32b809079e562f8ead2522c6b7b", "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+                   from_hex(sp_800_38a_plaintext),
+                   "1abc932417521ca24f2b0459fe7e6e0b090339ec0aa6faefd5ccc2c6f4ce8e941e36b26bd1ebc670d1bd1d665620abf74f"
+                   "78a7f6d29809585a97daec58c6b050");
+}
+
+BOOST_AUTO_TEST_CASE(ctr_aes_256) {
+    check_ctr<256>("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4",
+                   "f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff", from_hex(sp_800_38a_plaintext),
+                   "601ec313775789a5b7a7f504bbf3d228f443e3ca4d62b59aca84e990cacaf5c52b0930daa23de94ce87017ba2d84988ddf"
+                   "c9c58db67aada613c2dd08457941a6");
+}
+
+// The counter wraps around the whole 128-bit block in the middle of a batch
+BOOST_AUTO_TEST_CASE(ctr_aes_128_counter_wrap) {
+    std::vector<std::uint8_t> plaintext(200);
+    for (std::size_t i = 0; i < plaintext.size(); i++) {
+        plaintext[i] = static_cast<std::uint8_t>(i);
+    }
+
+    check_ctr<128>("2b7e151628aed2a6abf7158809cf4f3c", "fffffffffffffffffffffffffffffffd", plaintext,
+                   "fefb3a19e242a42f9f17d10950637cedc1a606a5efe0e9e63083f4315053f3bcaad3a42266d2a0d321195631135384834d"
+                   "c6593f2e8daf84067bca7c85266a5017533f0370f4f8f8e6bd2cf28b3f2189c76e7ca01c2cb455274e6e6b63af41d626fd"
+                   "1da811b0bfc6dc71a1f21764cfeafa0d45de084ba9453127b4b1a2bf4f636fa95aa4bd780af6cfbbb5f51d4d4575a0f776"
+                   "8df3081e2f7772e1a6d66e685e2bcb52b96fd1c26cc06d09ff26023b09bccd16c9a941c7021aca44780293e7e4ffb21254"
+                   "43fb9cf9");
 }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+BOOST_AUTO_TEST_SUITE_END()
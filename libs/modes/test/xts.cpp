@@ -22,19 +22,110 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //---------------------------------------------------------------------------//
-
 #define BOOST_TEST_MODULE xts_test
 
-#include <nil/crypto3/modes/xts.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
 
-BOOST_AUTO_TEST_SUITE(xts_mode_test_suite)
+#include <nil/crypto3/block/rijndael.hpp>
+
+#include <nil/crypto3/modes/xts.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::block;
+
+namespace {
+    std::vector<std::uint8_t> from_hex(const std::string &hex) {
+        std::vector<std::uint8_t> result(hex.size() / 2);
+        for (std::size_t i = 0; i < result.size(); i++) {
+            result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return result;
+    }
+
+    template<std::size_t KeyBits>
+    typename rijndael<KeyBits, 128>::key_type make_key(const std::string &hex) {
+        const std::vector<std::uint8_t> bytes = from_hex(hex);
+        typename rijndael<KeyBits, 128>::key_type key {};
+        std::copy(bytes.begin(), bytes.end(), key.begin());
+        return key;
+    }
 
-    BOOST_AUTO_TEST_CASE(xts_mode_test_case) {
+    std::vector<std::uint8_t> counting_bytes(std::size_t n) {
+        std::vector<std::uint8_t> result(n);
+        for (std::size_t i = 0; i < n; i++) {
+            result[i] = static_cast<std::uint8_t>(i);
+        }
+        return result;
+    }
+
+    template<std::size_t KeyBits>
+    void check_xts(const std::string &data_key, const std::string &tweak_key, std::uint64_t data_unit,
+                   const std::vector<std::uint8_t> &plaintext, const std::string &ciphertext) {
+        typedef rijndael<KeyBits, 128> cipher_type;
+        typedef modes::xts<cipher_type> mode_type;
+        typedef typename mode_type::template bind<modes::detail::xts_encryption_policy>::type encryption_type;
+        typedef typename mode_type::template bind<modes::detail::xts_decryption_policy>::type decryption_type;
+
+        encryption_type enc(make_key<KeyBits>(data_key), make_key<KeyBits>(tweak_key));
+        decryption_type dec(make_key<KeyBits>(data_key), make_key<KeyBits>(tweak_key));
 
+        std::vector<std::uint8_t> out(plaintext.size());
+        enc.process(data_unit, plaintext.data(), out.data(), plaintext.size());
+        BOOST_CHECK(out == from_hex(ciphertext));
+
+        // In place
+        dec.process(data_unit, out.data(), out.data(), out.size());
+        BOOST_CHECK(out == plaintext);
     }
 
-BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
+    const std::string key_15 = "fffefdfcfbfaf9f8f7f6f5f4f3f2f1f0";
+    const std::string tweak_key_15 = "bfbebdbcbbbab9b8b7b6b5b4b3b2b1b0";
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(xts_mode_test_suite)
+
+// IEEE 1619-2007 vectors 1-3
+BOOST_AUTO_TEST_CASE(xts_aes_128_whole_blocks) {
+    check_xts<128>("00000000000000000000000000000000", "00000000000000000000000000000000", 0,
+                   std::vector<std::uint8_t>(32, 0),
+                   "917cf69ebd68b2ec9b9fe9a3eadda692cd43d2f59598ed858c02c2652fbf922e");
+    check_xts<128>("11111111111111111111111111111111", "22222222222222222222222222222222", 0x3333333333,
+                   std::vector<std::uint8_t>(32, 0x44),
+                   "c454185e6a16936e39334038acef838bfb186fff7480adc4289382ecd6d394f0");
+    check_xts<128>(key_15, "22222222222222222222222222222222", 0x3333333333,
+                   std::vector<std::uint8_t>(32, 0x44),
+                   "af85336b597afc1a900b2eb21ec949d292df4c047e0b21532186a5971a227a89");
+}
+
+// IEEE 1619-2007 vectors 15-18
+BOOST_AUTO_TEST_CASE(xts_aes_128_ciphertext_stealing) {
+    check_xts<128>(key_15, tweak_key_15, 0x123456789a, counting_bytes(17), "6c1625db4671522d3d7599601de7ca09ed");
+    check_xts<128>(key_15, tweak_key_15, 0x123456789a, counting_bytes(18), "d069444b7a7e0cab09e24447d24deb1fedbf");
+    check_xts<128>(key_15, tweak_key_15, 0x123456789a, counting_bytes(19), "e5df1351c0544ba1350b3363cd8ef4beedbf9d");
+    check_xts<128>(key_15, tweak_key_15, 0x123456789a, counting_bytes(20),
+                   "9d84c813f719aa2c7be3f66171c7c5c2edbf9dac");
+}
+
+// Longer data units go through several batches of interleaved blocks
+BOOST_AUTO_TEST_CASE(xts_aes_multi_batch) {
+    check_xts<128>(key_15, tweak_key_15, 0x123456789a, counting_bytes(200),
+                   "edbf9dace45d6f6a7306e64be5dd824b2538f5724fcf24249ac111ab45ad39233ad6183c66fa548a3cdf3e36d2b21ccdc6"
+                   "bc657cb3aeb87ba2c5f58ffafacd76d0a098b687c0b6536d560ca007051b0b449bad44225a2b9884a1695666c5656ec9e3"
+                   "03ece29d65dcad21169950fe3a7d501770aa1b4a5e512af210c8276f265b9b9b1b6f2392bedfc110fd7dba658c0e362d81"
+                   "8868213c969e5228e9bcebc4f29b7bc00feb28618e3b478988a99de8776dc90378d39ae59c065e9b441f616560d1053164"
+                   "caad0d58");
+    check_xts<256>("2718281828459045235360287471352662497757247093699959574966967627",
+                   "3141592653589793238462643383279502884197169399375105820974944592", 0xff, counting_bytes(160),
+                   "1c3b3a102f770386e4836c99e370cf9bea00803f5e482357a4ae12d414a3e63b5d31e276f8fe4a8d66b317f9ac683f4468"
+                   "0a86ac35adfc3345befecb4bb188fd5776926c49a3095eb108fd1098baec70aaa66999a72a82f27d848b21d4a741b0c5cd"
+                   "4d5fff9dac89aeba122961d03a757123e9870f8acf1000020887891429ca2a3e7a7d7df7b10355165c8b9a6d0a7de8b062"
+                   "c4500dc4cd120c0f7418dae3d0");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+#define CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/range/concepts.hpp>
+
+#include <nil/crypto3/pubkey/keys/public_key.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /*!
+                 * @brief Checks a batch of signatures together if the public key of the scheme provides batch_item
+                 * and a static batch_verify over a range of batch items, and one by one otherwise.
+                 */
+                template<typename SchemeType, typename = void>
+                struct batch_verifier {
+                    typedef public_key<SchemeType> public_key_type;
+                    typedef typename public_key_type::accumulator_type accumulator_type;
+                    typedef typename public_key_type::signature_type signature_type;
+
+                    template<typename MessageIterator, typename SignatureIterator, typename KeyIterator,
+                             typename OutputIterator>
+                    static OutputIterator process(MessageIterator message, SignatureIterator signature,
+                                                  KeyIterator key, std::size_t count, OutputIterator invalid) {
+                        for (std::size_t i = 0; i < count; ++i, ++message, ++signature, ++key) {
+                            accumulator_type acc;
+                            key->init_accumulator(acc);
+                            key->update(acc, *message);
+                            if (!key->verify(acc, *signature)) {
+                                *invalid++ = i;
+                            }
+                        }
+                        return invalid;
+                    }
+
+                    template<typename MessageIterator, typename SignatureIterator, typename KeyIterator>
+                    static bool process(MessageIterator message, SignatureIterator signature, KeyIterator key,
+                                        std::size_t count) {
+                        for (std::size_t i = 0; i < count; ++i, ++message, ++signature, ++key) {
+                            accumulator_type acc;
+                            key->init_accumulator(acc);
+                            key->update(acc, *message);
+                            if (!key->verify(acc, *signature)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+
+                template<typename SchemeType>
+                struct batch_verifier<SchemeType,
+                                      typename std::enable_if<sizeof(typename public_key<SchemeType>::batch_item_type) !=
+                                                              0>::type> {
+                    typedef public_key<SchemeType> public_key_type;
+                    typedef typename public_key_type::accumulator_type accumulator_type;
+                    typedef typename public_key_type::batch_item_type batch_item_type;
+                    typedef typename std::vector<batch_item_type>::const_iterator item_iterator;
+
+                    template<typename MessageIterator, typename SignatureIterator, typename KeyIterator,
+                             typename OutputIterator>
+                    static OutputIterator process(MessageIterator message, SignatureIterator signature,
+                                                  KeyIterator key, std::size_t count, OutputIterator invalid) {
+                        const std::vector<batch_item_type> items = prepare(message, signature, key, count);
+                        return bisect(items.begin(), items.end(), 0, invalid);
+                    }
+
+                    template<typename MessageIterator, typename SignatureIterator, typename KeyIterator>
+                    static bool process(MessageIterator message, SignatureIterator signature, KeyIterator key,
+                                        std::size_t count) {
+                        const std::vector<batch_item_type> items = prepare(message, signature, key, count);
+                        return public_key_type::batch_verify(items.begin(), items.end());
+                    }
+
+                private:
+                    template<typename MessageIterator, typename SignatureIterator, typename KeyIterator>
+                    static std::vector<batch_item_type> prepare(MessageIterator message, SignatureIterator signature,
+                                                                KeyIterator key, std::size_t count) {
+                        std::vector<batch_item_type> items;
+                        items.reserve(count);
+                        for (std::size_t i = 0; i < count; ++i, ++message, ++signature, ++key) {
+                            accumulator_type acc;
+                            key->init_accumulator(acc);
+                            key->update(acc, *message);
+                            items.emplace_back(key->batch_item(acc, *signature));
+                        }
+                        return items;
+                    }
+
+                    /// Looks for the invalid signatures of a failed batch by checking both halves separately
+                    template<typename OutputIterator>
+                    static OutputIterator bisect(item_iterator first, item_iterator last, std::size_t offset,
+                                                 OutputIterator invalid) {
+                        const std::size_t count = std::distance(first, last);
+                        if (count == 0 || public_key_type::batch_verify(first, last)) {
+                            return invalid;
+                        }
+                        if (count == 1) {
+                            *invalid++ = offset;
+                            return invalid;
+                        }
+
+                        const std::size_t half = count / 2;
+                        invalid = bisect(first, first + half, offset, invalid);
+                        return bisect(first + half, last, offset + half, invalid);
+                    }
+                };
+            }    // namespace detail
+        }        // namespace pubkey
+
+        /*!
+         * @brief Batch verification of the signatures of several messages, each one on its own key.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * Schemes supporting it check a random linear combination of the verification equations of the whole
+         * batch at once (one multi-scalar multiplication for EdDSA, one multi-pairing for BLS). If the batch
+         * fails, it is split in halves until the invalid signatures are found. Other schemes verify the
+         * signatures one by one.
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam MessageRange range of message ranges
+         * @tparam SignatureRange range of \p public_key<Scheme>::signature_type
+         * @tparam KeyRange range of \p public_key<Scheme>
+         * @tparam OutputIterator iterator accepting std::size_t
+         *
+         * @param messages signed messages
+         * @param signatures signatures of \p messages
+         * @param keys public keys to verify \p signatures with
+         * @param invalid the beginning of the destination range for the indices of the invalid signatures
+         *
+         * @return \p OutputIterator past the last written index
+         */
+        template<typename SchemeType, typename MessageRange, typename SignatureRange, typename KeyRange,
+                 typename OutputIterator>
+        OutputIterator batch_verify(const MessageRange &messages, const SignatureRange &signatures,
+                                    const KeyRange &keys, OutputIterator invalid) {
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MessageRange>));
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+
+            const std::size_t count = std::distance(std::cbegin(messages), std::cend(messages));
+            BOOST_ASSERT_MSG(count == std::size_t(std::distance(std::cbegin(signatures), std::cend(signatures))) &&
+                                 count == std::size_t(std::distance(std::cbegin(keys), std::cend(keys))),
+                             "messages, signatures and keys should have the same size");
+
+            return pubkey::detail::batch_verifier<SchemeType>::process(
+                std::cbegin(messages), std::cbegin(signatures), std::cbegin(keys), count, invalid);
+        }
+
+        /*!
+         * @brief Batch verification of the signatures of several messages, each one on its own key.
+         *
+         * @ingroup pubkey_algorithms
+         *
+         * @tparam Scheme public key signature scheme
+         * @tparam MessageRange range of message ranges
+         * @tparam SignatureRange range of \p public_key<Scheme>::signature_type
+         * @tparam KeyRange range of \p public_key<Scheme>
+         *
+         * @param messages signed messages
+         * @param signatures signatures of \p messages
+         * @param keys public keys to verify \p signatures with
+         *
+         * @return true if all the signatures are valid
+         */
+        template<typename SchemeType, typename MessageRange, typename SignatureRange, typename KeyRange>
+        bool batch_verify(const MessageRange &messages, const SignatureRange &signatures, const KeyRange &keys) {
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const MessageRange>));
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const SignatureRange>));
+            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<const KeyRange>));
+
+            const std::size_t count = std::distance(std::cbegin(messages), std::cend(messages));
+            BOOST_ASSERT_MSG(count == std::size_t(std::distance(std::cbegin(signatures), std::cend(signatures))) &&
+                                 count == std::size_t(std::distance(std::cbegin(keys), std::cend(keys))),
+                             "messages, signatures and keys should have the same size");
+
+            return pubkey::detail::batch_verifier<SchemeType>::process(std::cbegin(messages), std::cbegin(signatures),
+                                                                       std::cbegin(keys), count);
+        }
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_BATCH_VERIFY_HPP
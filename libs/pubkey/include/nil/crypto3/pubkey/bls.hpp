@@ -107,6 +107,18 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                typedef typename basic_functions::batch_item_type batch_item_type;
+
+                static inline batch_item_type batch_item(accumulator_type &acc, const public_key_type &pubkey,
+                                                         const signature_type &sig) {
+                    return basic_functions::batch_item(acc, pubkey, sig);
+                }
+
+                template<typename InputIterator>
+                static inline bool batch_verify(InputIterator first, InputIterator last) {
+                    return basic_functions::batch_verify(first, last);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -177,6 +189,18 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                typedef typename basic_functions::batch_item_type batch_item_type;
+
+                static inline batch_item_type batch_item(accumulator_type &acc, const public_key_type &pubkey,
+                                                         const signature_type &sig) {
+                    return basic_functions::batch_item(acc, pubkey, sig);
+                }
+
+                template<typename InputIterator>
+                static inline bool batch_verify(InputIterator first, InputIterator last) {
+                    return basic_functions::batch_verify(first, last);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -245,6 +269,18 @@ namespace nil {
                     return basic_functions::verify(acc, pubkey, sig);
                 }
 
+                typedef typename basic_functions::batch_item_type batch_item_type;
+
+                static inline batch_item_type batch_item(accumulator_type &acc, const public_key_type &pubkey,
+                                                         const signature_type &sig) {
+                    return basic_functions::batch_item(acc, pubkey, sig);
+                }
+
+                template<typename InputIterator>
+                static inline bool batch_verify(InputIterator first, InputIterator last) {
+                    return basic_functions::batch_verify(first, last);
+                }
+
                 template<typename SignatureRange>
                 static inline void update_aggregate(signature_type &acc, const SignatureRange &signatures) {
                     basic_functions::aggregate(acc, signatures);
@@ -398,6 +434,17 @@ namespace nil {
                     return bls_scheme_type::verify(acc, pubkey, sig);
                 }
 
+                typedef typename bls_scheme_type::batch_item_type batch_item_type;
+
+                batch_item_type batch_item(accumulator_type &acc, const signature_type &sig) const {
+                    return bls_scheme_type::batch_item(acc, pubkey, sig);
+                }
+
+                template<typename InputIterator>
+                static bool batch_verify(InputIterator first, InputIterator last) {
+                    return bls_scheme_type::batch_verify(first, last);
+                }
+
                 schedule_type public_key_data() const {
                     return pubkey;
                 }
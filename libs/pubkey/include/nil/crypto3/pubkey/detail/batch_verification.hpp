@@ -0,0 +1,68 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_PUBKEY_DETAIL_BATCH_VERIFICATION_HPP
+#define CRYPTO3_PUBKEY_DETAIL_BATCH_VERIFICATION_HPP
+
+#include <cstddef>
+#include <limits>
+
+#include <boost/random/random_device.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace pubkey {
+            namespace detail {
+                /// Bit length of the random weights of the linear combination checked by batch verification
+                constexpr static const std::size_t batch_verification_weight_bits = 128;
+
+                /*!
+                 * @brief Non-zero random scalar of batch_verification_weight_bits bits. A batch with an invalid
+                 * signature passes the randomized check with probability at most 2^-batch_verification_weight_bits
+                 * as long as the checked points lie in a group of prime order. An error term of small order h
+                 * vanishes from the combination whenever its weight is divisible by h, so on curves with a cofactor
+                 * the combined check has to be multiplied by it, and so does the single signature check.
+                 */
+                template<typename ScalarFieldValueType, typename UniformRandomBitGenerator>
+                ScalarFieldValueType random_batch_weight(UniformRandomBitGenerator &rng) {
+                    typedef typename ScalarFieldValueType::integral_type integral_type;
+                    constexpr const std::size_t word_bits =
+                        std::numeric_limits<typename UniformRandomBitGenerator::result_type>::digits;
+
+                    integral_type weight = 0;
+                    for (std::size_t bits = 0; bits < batch_verification_weight_bits; bits += word_bits) {
+                        weight <<= word_bits;
+                        weight |= integral_type(rng());
+                    }
+                    if (weight == 0) {
+                        weight = 1;
+                    }
+                    return ScalarFieldValueType(weight);
+                }
+            }    // namespace detail
+        }        // namespace pubkey
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_PUBKEY_DETAIL_BATCH_VERIFICATION_HPP
@@ -37,13 +37,18 @@
 #include <boost/concept_check.hpp>
 
 #include <boost/range/concepts.hpp>
+#include <boost/random/random_device.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 
 #include <nil/crypto3/detail/type_traits.hpp>
 
+#include <nil/crypto3/pubkey/detail/batch_verification.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
@@ -53,9 +58,11 @@ namespace nil {
                     typedef typename PolicyType::curve_type curve_type;
                     typedef typename PolicyType::gt_value_type gt_value_type;
                     typedef typename PolicyType::private_key_type private_key_type;
+                    typedef typename PolicyType::public_key_group_type public_key_group_type;
                     typedef typename PolicyType::public_key_type public_key_type;
                     typedef typename PolicyType::signature_type signature_type;
                     typedef typename PolicyType::h2c_policy h2c_policy;
+                    typedef typename PolicyType::pairing_argument_type pairing_argument_type;
 
                     typedef typename PolicyType::bls_serializer bls_serializer;
                     typedef typename PolicyType::public_key_serialized_type public_key_serialized_type;
@@ -87,7 +94,7 @@ namespace nil {
                     static public_key_type privkey_to_pubkey(const private_key_type &sk) {
                         BOOST_ASSERT(validate_private_key(sk));
 
-                        return sk * public_key_type::one();
+                        return algebra::generator_mul<public_key_group_type>(sk);
                     }
 
                     static bool validate_public_key(const public_key_type &pk) {
@@ -125,9 +132,66 @@ namespace nil {
                             return false;
                         }
                         signature_type Q = crypto3::accumulators::extract::hash<h2c_policy>(acc);
-                        auto C1 = PolicyType::pairing(Q, pk);
-                        auto C2 = PolicyType::pairing(sig, public_key_type::one());
-                        return C1 == C2;
+                        // e(Q, pk) == e(sig, g) is checked as e(Q, pk) * e(-sig, g) == 1
+                        const std::array<pairing_argument_type, 2> arguments = {
+                            PolicyType::pairing_argument(Q, pk),
+                            PolicyType::pairing_argument(-sig, public_key_type::one())};
+                        return PolicyType::pairing_product(arguments.begin(), arguments.end()) ==
+                               gt_value_type::one();
+                    }
+
+                    /// Hashed message, public key and signature of one message, as used by batch_verify
+                    struct batch_item_type {
+                        bool well_formed;
+                        signature_type hashed_message;
+                        public_key_type public_key;
+                        signature_type signature;
+                    };
+
+                    /// The signature and the public key must lie in the prime order subgroups: a component of
+                    /// cofactor order would survive the random combination of batch_verify with probability 1/h.
+                    static batch_item_type batch_item(const accumulator_type &acc, const public_key_type &pk,
+                                                      const signature_type &sig) {
+                        batch_item_type item;
+                        item.well_formed = sig.is_well_formed() && algebra::curves::detail::subgroup_check(sig) &&
+                                           validate_public_key(pk) && algebra::curves::detail::subgroup_check(pk);
+                        item.hashed_message = crypto3::accumulators::extract::hash<h2c_policy>(acc);
+                        item.public_key = pk;
+                        item.signature = sig;
+                        return item;
+                    }
+
+                    /*!
+                     * @brief Checks the batch items of [first, last) with a single multi-pairing: for random z_i,
+                     * prod e(z_i * H(m_i), pk_i) * e(-sum z_i * sig_i, g) must be one. A single item is checked
+                     * exactly as in verify.
+                     */
+                    template<typename InputIterator>
+                    static bool batch_verify(InputIterator first, InputIterator last) {
+                        const std::size_t count = std::distance(first, last);
+                        for (InputIterator it = first; it != last; ++it) {
+                            if (!it->well_formed) {
+                                return false;
+                            }
+                        }
+                        if (count == 0) {
+                            return true;
+                        }
+
+                        boost::random_device rng;
+                        std::vector<pairing_argument_type> arguments;
+                        arguments.reserve(count + 1);
+                        signature_type signature_sum = signature_type::zero();
+                        for (InputIterator it = first; it != last; ++it) {
+                            const private_key_type z = count == 1 ? private_key_type::one() :
+                                                                    random_batch_weight<private_key_type>(rng);
+                            arguments.push_back(PolicyType::pairing_argument(z * it->hashed_message, it->public_key));
+                            signature_sum = signature_sum + z * it->signature;
+                        }
+                        arguments.push_back(PolicyType::pairing_argument(-signature_sum, public_key_type::one()));
+
+                        return PolicyType::pairing_product(arguments.begin(), arguments.end()) ==
+                               gt_value_type::one();
                     }
 
                     template<typename SignatureIterator,
@@ -167,15 +231,18 @@ namespace nil {
                         }
                         auto pk_n_iter = std::cbegin(pk_n);
                         auto acc_n_iter = std::cbegin(acc_n);
-                        gt_value_type C1 = gt_value_type::one();
+                        std::vector<pairing_argument_type> arguments;
+                        arguments.reserve(pk_n.size() + 1);
                         while (pk_n_iter != std::cend(pk_n) && acc_n_iter != std::cend(acc_n)) {
                             if (!validate_public_key(*pk_n_iter)) {
                                 return false;
                             }
                             signature_type Q = nil::crypto3::accumulators::extract::hash<h2c_policy>(*acc_n_iter++);
-                            C1 = C1 * PolicyType::pairing(Q, *pk_n_iter++);
+                            arguments.push_back(PolicyType::pairing_argument(Q, *pk_n_iter++));
                         }
-                        return C1 == PolicyType::pairing(sig, public_key_type::one());
+                        arguments.push_back(PolicyType::pairing_argument(-sig, public_key_type::one()));
+                        return PolicyType::pairing_product(arguments.begin(), arguments.end()) ==
+                               gt_value_type::one();
                     }
 
                     static bool aggregate_verify(const fast_aggregation_accumulator_type &acc,
@@ -204,9 +271,11 @@ namespace nil {
                     static bool pop_verify(const public_key_type &pk, const signature_type &pop) {
                         if (pop.is_well_formed() && validate_public_key(pk)) {
                             signature_type Q = hash<h2c_policy>(point_to_pubkey(pk));
-                            auto C1 = PolicyType::pairing(Q, pk);
-                            auto C2 = PolicyType::pairing(pop, public_key_type::one());
-                            return C1 == C2;
+                            const std::array<pairing_argument_type, 2> arguments = {
+                                PolicyType::pairing_argument(Q, pk),
+                                PolicyType::pairing_argument(-pop, public_key_type::one())};
+                            return PolicyType::pairing_product(arguments.begin(), arguments.end()) ==
+                                   gt_value_type::one();
                         }
 
                         return false;
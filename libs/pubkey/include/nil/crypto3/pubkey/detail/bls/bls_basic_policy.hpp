@@ -27,6 +27,7 @@
 #define CRYPTO3_PUBKEY_BLS_BASIC_POLICY_HPP
 
 #include <cstddef>
+#include <utility>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/h2c.hpp>
@@ -85,6 +86,20 @@ namespace nil {
                     static inline gt_value_type pairing(const signature_type &U, const public_key_type &V) {
                         return algebra::pair_reduced<curve_type>(U, V);
                     }
+
+                    /// (g1, g2) arguments of the pairing of U and V
+                    typedef std::pair<signature_type, public_key_type> pairing_argument_type;
+
+                    static inline pairing_argument_type pairing_argument(const signature_type &U,
+                                                                         const public_key_type &V) {
+                        return pairing_argument_type(U, V);
+                    }
+
+                    /// Product of the pairings of a range of pairing_argument_type, with a single final exponentiation
+                    template<typename InputIterator>
+                    static inline gt_value_type pairing_product(InputIterator first, InputIterator last) {
+                        return algebra::multi_pair_reduced<curve_type>(first, last);
+                    }
                 };
 
                 //
@@ -122,6 +137,20 @@ namespace nil {
                         return algebra::pair_reduced<curve_type>(V, U);
                     }
 
+                    /// (g1, g2) arguments of the pairing of U and V
+                    typedef std::pair<public_key_type, signature_type> pairing_argument_type;
+
+                    static inline pairing_argument_type pairing_argument(const signature_type &U,
+                                                                         const public_key_type &V) {
+                        return pairing_argument_type(V, U);
+                    }
+
+                    /// Product of the pairings of a range of pairing_argument_type, with a single final exponentiation
+                    template<typename InputIterator>
+                    static inline gt_value_type pairing_product(InputIterator first, InputIterator last) {
+                        return algebra::multi_pair_reduced<curve_type>(first, last);
+                    }
+
                     static inline public_key_serialized_type point_to_pubkey(const public_key_type &pubkey) {
                         return bls_serializer::point_to_octets_compress(pubkey);
                     }
@@ -28,6 +28,9 @@
 
 #include <utility>
 
+#include <nil/crypto3/algebra/double_scalar_mul.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
+
 #include <nil/crypto3/random/rfc6979.hpp>
 
 #include <nil/crypto3/pkpad/algorithms/encode.hpp>
@@ -125,7 +128,8 @@ namespace nil {
                             padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
 
                     scalar_field_value_type w = signature.second.inversed();
-                    g1_value_type X = (encoded_m * w) * g1_value_type::one() + (signature.first * w) * pubkey;
+                    g1_value_type X = algebra::double_scalar_mul<g1_type>(encoded_m * w, g1_value_type::one(),
+                                                                          signature.first * w, pubkey);
                     if (X.is_zero()) {
                         return false;
                     }
@@ -162,6 +166,7 @@ namespace nil {
                 typedef padding::encoding_accumulator_set<padding_policy> accumulator_type;
 
                 typedef typename base_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename base_type::g1_type g1_type;
                 typedef typename base_type::g1_value_type g1_value_type;
                 typedef typename base_type::base_integral_type base_integral_type;
                 typedef typename base_type::scalar_modular_type scalar_modular_type;
@@ -174,7 +179,7 @@ namespace nil {
                 }
 
                 static inline public_key_schedule_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_schedule_type::one();
+                    return algebra::generator_mul<g1_type>(key);
                 }
 
                 static inline void init_accumulator(accumulator_type &acc) {
@@ -209,7 +214,7 @@ namespace nil {
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
                         r = scalar_field_value_type(scalar_modular_type(typename scalar_modular_type::backend_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
+                            static_cast<base_integral_type>(algebra::generator_mul<g1_type>(k).to_affine().X.data),
                             scalar_field_value_type::modulus)));
                         s = k.inversed() * (privkey * r + encoded_m);
                     } while (r.is_zero() || s.is_zero());
@@ -243,6 +248,7 @@ namespace nil {
                 accumulator_type;
 
                 typedef typename base_type::scalar_field_value_type scalar_field_value_type;
+                typedef typename base_type::g1_type g1_type;
                 typedef typename base_type::g1_value_type g1_value_type;
                 typedef typename base_type::base_integral_type base_integral_type;
                 typedef typename base_type::scalar_modular_type scalar_modular_type;
@@ -255,7 +261,7 @@ namespace nil {
                 }
 
                 static inline public_key_schedule_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_schedule_type::one();
+                    return algebra::generator_mul<g1_type>(key);
                 }
 
                 static inline void init_accumulator(accumulator_type &acc) {
@@ -292,7 +298,7 @@ namespace nil {
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
                         r = scalar_field_value_type(scalar_modular_type(typename scalar_modular_type::backend_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
+                            static_cast<base_integral_type>(algebra::generator_mul<g1_type>(k).to_affine().X.data),
                             scalar_field_value_type::modulus)));
                         s = (privkey * r + encoded_m) * k.inversed();
                     } while (r.is_zero() || s.is_zero());
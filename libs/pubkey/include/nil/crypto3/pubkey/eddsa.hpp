@@ -30,7 +30,13 @@
 #include <array>
 #include <vector>
 
+#include <boost/random/random_device.hpp>
+
 #include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/double_scalar_mul.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
@@ -40,6 +46,7 @@
 #include <nil/crypto3/pkpad/emsa/emsa_raw.hpp>
 
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
+#include <nil/crypto3/pubkey/detail/batch_verification.hpp>
 
 #include <nil/crypto3/pubkey/type_traits.hpp>
 
@@ -191,6 +198,9 @@ namespace nil {
                 constexpr static const std::size_t signature_bits = 64 * std::numeric_limits<std::uint8_t>::digits;
                 typedef static_digest<signature_bits> signature_type;
 
+                // c in https://datatracker.ietf.org/doc/html/rfc8032#section-5.1, the cofactor is 2^c
+                constexpr static const std::size_t cofactor_bits = 3;
+
                 public_key() = delete;
 
                 public_key(const schedule_type &key) : pubkey_point(read_pubkey(key)), pubkey(key) {
@@ -209,16 +219,51 @@ namespace nil {
                     encode<padding_policy>(first, last, acc);
                 }
 
+                /// Decoded signature and challenge of one message, as used by verify and batch_verify
+                struct batch_item_type {
+                    bool well_formed;
+                    group_value_type R;
+                    scalar_field_value_type S;
+                    scalar_field_value_type k;
+                    group_value_type A;
+                };
+
                 // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7
                 inline bool verify(accumulator_type &acc, const signature_type &signature) const {
+                    const batch_item_type item = batch_item(acc, signature);
+
+                    return item.well_formed && verify_item(item);
+                }
+
+                // 3. [2^c][S]B = [2^c]R + [2^c][k]A', small order components of R and A' are cleared
+                static inline bool verify_item(const batch_item_type &item) {
+                    return mul_by_cofactor(
+                               algebra::double_scalar_mul<group_type>(item.S, group_value_type::one(), -item.k, item.A) -
+                               item.R)
+                        .is_zero();
+                }
+
+                static inline group_value_type mul_by_cofactor(group_value_type point) {
+                    for (std::size_t i = 0; i < cofactor_bits; ++i) {
+                        point.double_inplace();
+                    }
+                    return point;
+                }
+
+                // https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.7, steps 1 and 2
+                inline batch_item_type batch_item(accumulator_type &acc, const signature_type &signature) const {
+                    batch_item_type item;
+                    item.well_formed = false;
+                    item.A = this->pubkey_point;
+
                     // 1.
                     marshalling_group_value_type marshalling_group_value_1;
                     auto R_iter_1 = std::cbegin(signature);
                     if (marshalling_group_value_1.read(R_iter_1, marshalling_group_value_type::bit_length()) !=
                         nil::marshalling::status_type::success) {
-                        return false;
+                        return item;
                     }
-                    group_value_type R = marshalling_group_value_1.value();
+                    item.R = marshalling_group_value_1.value();
 
                     marshalling_scalar_field_value_type marshalling_scalar_field_value_1;
                     auto S_iter_1 = std::cbegin(signature) +
@@ -227,9 +272,9 @@ namespace nil {
                     if (marshalling_scalar_field_value_1.read(S_iter_1,
                                                               marshalling_scalar_field_value_type::bit_length()) !=
                         nil::marshalling::status_type::success) {
-                        return false;
+                        return item;
                     }
-                    scalar_field_value_type S = marshalling_scalar_field_value_1.value();
+                    item.S = marshalling_scalar_field_value_1.value();
 
                     // 2.
                     auto ph_m = padding::accumulators::extract::encode<padding::encoding_policy<padding_policy>>(acc);
@@ -248,7 +293,7 @@ namespace nil {
 
                     if (marshalling_uint512_t_2.read(h_2_iter, hash_type::digest_bits) !=
                         nil::marshalling::status_type::success) {
-                        return false;
+                        return item;
                     }
                     boost::multiprecision::uint512_t k = marshalling_uint512_t_2.value();
 
@@ -258,10 +303,57 @@ namespace nil {
                     boost::multiprecision::uint512_modular_t k_modular =
                             boost::multiprecision::uint512_modular_t::backend_type(
                                 k.backend());
-                    scalar_field_value_type k_reduced(k_modular);
+                    item.k = scalar_field_value_type(k_modular);
+                    item.well_formed = true;
 
-                    // 3.
-                    return (S * group_value_type::one()) == (R + k_reduced * this->pubkey_point);
+                    return item;
+                }
+
+                /*!
+                 * @brief Checks the batch items of [first, last) with a single multi-scalar multiplication: for
+                 * random z_i, (sum z_i * S_i) * B - sum z_i * R_i - sum (z_i * k_i) * A_i times the cofactor must be
+                 * zero. As in verify, the equation is cofactored, so small order components of R_i and A_i cancel
+                 * out regardless of z_i and the batch accepts exactly when every item passes verify, up to the
+                 * 2^-batch_verification_weight_bits chance of the random weights. A single item is checked exactly
+                 * as in verify.
+                 */
+                template<typename InputIterator>
+                static bool batch_verify(InputIterator first, InputIterator last) {
+                    const std::size_t count = std::distance(first, last);
+                    for (InputIterator it = first; it != last; ++it) {
+                        if (!it->well_formed) {
+                            return false;
+                        }
+                    }
+                    if (count == 0) {
+                        return true;
+                    }
+                    if (count == 1) {
+                        return verify_item(*first);
+                    }
+
+                    boost::random_device rng;
+                    std::vector<group_value_type> bases;
+                    std::vector<scalar_field_value_type> scalars;
+                    bases.reserve(2 * count + 1);
+                    scalars.reserve(2 * count + 1);
+
+                    scalar_field_value_type S_sum = scalar_field_value_type::zero();
+                    for (InputIterator it = first; it != last; ++it) {
+                        const scalar_field_value_type z =
+                            detail::random_batch_weight<scalar_field_value_type>(rng);
+                        S_sum += z * it->S;
+                        bases.emplace_back(-it->R);
+                        scalars.emplace_back(z);
+                        bases.emplace_back(-it->A);
+                        scalars.emplace_back(z * it->k);
+                    }
+                    bases.emplace_back(group_value_type::one());
+                    scalars.emplace_back(S_sum);
+
+                    return mul_by_cofactor(algebra::multiexp<algebra::policies::multiexp_method_pippenger>(
+                                               bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1))
+                        .is_zero();
                 }
 
                 inline schedule_type public_key_data() const {
@@ -293,6 +385,7 @@ namespace nil {
                 typedef typename scheme_public_key_type::padding_policy padding_policy;
                 typedef typename scheme_public_key_type::accumulator_type accumulator_type;
 
+                typedef typename scheme_public_key_type::group_type group_type;
                 typedef typename scheme_public_key_type::group_value_type group_value_type;
                 typedef typename scheme_public_key_type::scalar_field_type scalar_field_type;
                 typedef typename scheme_public_key_type::scalar_field_value_type scalar_field_value_type;
@@ -337,7 +430,7 @@ namespace nil {
                     base_integral_type s = construct_scalar(h);
 
                     // 3.
-                    group_value_type sB = scalar_field_value_type(s) * group_value_type::one();
+                    group_value_type sB = algebra::generator_mul<group_type>(scalar_field_value_type(s));
 
                     // 4.
                     marshalling_group_value_type marshalling_group_value(sB);
@@ -396,7 +489,7 @@ namespace nil {
                     scalar_field_value_type r_reduced(r_modular);
 
                     // 3.
-                    group_value_type rB = r_reduced * group_value_type::one();
+                    group_value_type rB = algebra::generator_mul<group_type>(r_reduced);
                     marshalling_group_value_type marshalling_group_value(rB);
                     signature_type signature;
                     auto sig_iter_3 = std::begin(signature);
@@ -36,6 +36,8 @@
 
 #include <boost/range/concepts.hpp>
 
+#include <nil/crypto3/algebra/generator_mul.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace pubkey {
@@ -88,7 +90,7 @@ namespace nil {
                 //===========================================================================
                 // TODO: refactor
                 static inline public_element_type get_public_element(const private_element_type &e) {
-                    return e * public_element_type::one();
+                    return algebra::generator_mul<GroupType>(e);
                 }
 
                 template<typename IndexedElementIt>
@@ -35,12 +35,15 @@
 #include <nil/crypto3/pubkey/algorithm/aggregate.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify.hpp>
 #include <nil/crypto3/pubkey/algorithm/aggregate_verify_single_msg.hpp>
+#include <nil/crypto3/pubkey/algorithm/batch_verify.hpp>
 
 #include <nil/crypto3/pubkey/bls.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 
+#include <iterator>
 #include <vector>
 #include <string>
 #include <utility>
@@ -473,6 +476,24 @@ void conformity_test(const std::vector<private_key<SchemeType>> &sks,
     BOOST_CHECK_EQUAL(res, true);
 }
 
+// First point with x = 1, 2, ... on the curve of GroupValueType which is not in the prime order subgroup
+template<typename GroupValueType>
+GroupValueType non_subgroup_point() {
+    using field_value_type = typename GroupValueType::field_type::value_type;
+
+    field_value_type x = field_value_type::one();
+    while (true) {
+        const field_value_type rhs = x.squared() * x + field_value_type(GroupValueType::params_type::b);
+        if (rhs.is_square()) {
+            const GroupValueType point(x, rhs.sqrt());
+            if (!curves::detail::subgroup_check(point)) {
+                return point;
+            }
+        }
+        x = x + field_value_type::one();
+    }
+}
+
 // TODO: add checks for wrong signatures
 template<typename SchemeType, typename MsgRange>
 void self_test(const std::vector<private_key<SchemeType>> &sks, const std::vector<MsgRange> &msgs) {
@@ -556,6 +577,42 @@ void self_test(const std::vector<private_key<SchemeType>> &sks, const std::vecto
 //    ::nil::crypto3::aggregate_verify<scheme_type>(agg_sig, agg_ver_acc);
     auto res = boost::accumulators::extract_result<aggregate_verification_acc>(agg_ver_acc);
     BOOST_CHECK_EQUAL(res, true);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Batch verify
+    std::vector<msg_type> batch_msgs(std::next(msgs.begin()), msgs.end());
+    std::vector<pubkey_type> batch_pks(std::next(sks.begin()), sks.end());
+    BOOST_CHECK(::nil::crypto3::batch_verify<scheme_type>(batch_msgs, sigs, batch_pks));
+
+    if (sigs.size() > 6) {
+        std::vector<signature_type> batch_sigs = sigs;
+        batch_sigs[2] = integral_type(2) * batch_sigs[2];
+        std::swap(batch_sigs[5], batch_sigs[6]);
+        BOOST_CHECK(!::nil::crypto3::batch_verify<scheme_type>(batch_msgs, batch_sigs, batch_pks));
+
+        std::vector<std::size_t> invalid;
+        ::nil::crypto3::batch_verify<scheme_type>(batch_msgs, batch_sigs, batch_pks, std::back_inserter(invalid));
+        BOOST_CHECK((invalid == std::vector<std::size_t> {2, 5, 6}));
+    }
+
+    if (sigs.size() > 4) {
+        std::vector<signature_type> batch_sigs = sigs;
+        std::vector<pubkey_type> off_subgroup_pks = batch_pks;
+        const signature_type sig_point = non_subgroup_point<signature_type>();
+        const _pubkey_type pk_point = non_subgroup_point<_pubkey_type>();
+        BOOST_CHECK(sig_point.is_well_formed());
+        BOOST_CHECK(pk_point.is_well_formed());
+
+        batch_sigs[1] = batch_sigs[1] + sig_point;
+        off_subgroup_pks[3] = pubkey_type(off_subgroup_pks[3].public_key_data() + pk_point);
+        BOOST_CHECK(!::nil::crypto3::batch_verify<scheme_type>(batch_msgs, batch_sigs, batch_pks));
+        BOOST_CHECK(!::nil::crypto3::batch_verify<scheme_type>(batch_msgs, sigs, off_subgroup_pks));
+
+        std::vector<std::size_t> invalid;
+        ::nil::crypto3::batch_verify<scheme_type>(batch_msgs, batch_sigs, off_subgroup_pks,
+                                                  std::back_inserter(invalid));
+        BOOST_CHECK((invalid == std::vector<std::size_t> {1, 3}));
+    }
 }
 
 template<typename SchemePopSign, typename SchemePopProve>
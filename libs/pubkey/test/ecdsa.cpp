@@ -177,6 +177,37 @@ BOOST_AUTO_TEST_SUITE(ecdsa_manual_test_suite)
         std::cout << wrong_result << std::endl;
     }
 
+    // Public keys G, 2G, 3G share table entries with the generator in the verification multiplication.
+    template<typename CurveType>
+    void ecdsa_small_private_key_test() {
+        using curve_type = CurveType;
+        using scalar_field_type = typename curve_type::scalar_field_type;
+        using scalar_field_value_type = typename scalar_field_type::value_type;
+        using hash_type = hashes::sha2<256>;
+        using padding_policy = pubkey::padding::emsa1<scalar_field_value_type, hash_type>;
+        using generator_type = random::algebraic_random_device<scalar_field_type>;
+        using policy_type = pubkey::ecdsa<curve_type, padding_policy, generator_type>;
+        using signature_type = typename pubkey::public_key<policy_type>::signature_type;
+
+        for (std::size_t x = 1; x <= 3; ++x) {
+            pubkey::private_key<policy_type> privkey((scalar_field_value_type(x)));
+            const auto &pk = static_cast<pubkey::public_key<policy_type>>(privkey);
+            for (std::size_t i = 0; i < 32; ++i) {
+                std::vector<std::uint8_t> msg = {std::uint8_t(x), std::uint8_t(i)};
+                signature_type sig = sign<policy_type>(msg, privkey);
+                BOOST_CHECK(static_cast<bool>(verify<policy_type>(msg, sig, pk)));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ecdsa_small_private_key_secp256r1) {
+        ecdsa_small_private_key_test<algebra::curves::secp256r1>();
+    }
+
+    BOOST_AUTO_TEST_CASE(ecdsa_small_private_key_secp256k1) {
+        ecdsa_small_private_key_test<algebra::curves::secp256k1>();
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(ecdsa_conformity_test_suite)
@@ -25,7 +25,9 @@
 
 #define BOOST_TEST_MODULE pubkey_eddsa_test
 
+#include <iterator>
 #include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -33,9 +35,12 @@
 
 #include <nil/crypto3/pubkey/algorithm/sign.hpp>
 #include <nil/crypto3/pubkey/algorithm/verify.hpp>
+#include <nil/crypto3/pubkey/algorithm/batch_verify.hpp>
 
 #include <nil/crypto3/pubkey/eddsa.hpp>
 
+#include <nil/crypto3/random/algebraic_random_device.hpp>
+
 using namespace nil::crypto3;
 using namespace nil::crypto3::algebra;
 using namespace nil::marshalling;
@@ -575,4 +580,86 @@ BOOST_AUTO_TEST_SUITE(eddsa_conformity_test_suite)
             msg1, private_key_type(privkey1), public_key_type(ref_pubkey1), ref_sig1);
     }
 
+    BOOST_AUTO_TEST_CASE(eddsa_batch_verify_test) {
+        using curve_type = algebra::curves::ed25519;
+        using group_type = typename curve_type::g1_type<>;
+
+        using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+        using private_key_type = pubkey::private_key<scheme_type>;
+        using public_key_type = pubkey::public_key<scheme_type>;
+        using signature_type = typename private_key_type::signature_type;
+
+        std::vector<std::vector<std::uint8_t>> msgs;
+        std::vector<signature_type> sigs;
+        std::vector<public_key_type> pubkeys;
+        for (std::size_t i = 0; i < 9; ++i) {
+            typename private_key_type::schedule_type privkey;
+            for (std::size_t j = 0; j < privkey.size(); ++j) {
+                privkey[j] = static_cast<std::uint8_t>(31 * i + j);
+            }
+            private_key_type private_key(privkey);
+
+            msgs.emplace_back(i + 1, static_cast<std::uint8_t>(i));
+            sigs.emplace_back(sign<scheme_type>(msgs.back(), private_key));
+            pubkeys.emplace_back(private_key.public_key_data());
+        }
+        BOOST_CHECK(batch_verify<scheme_type>(msgs, sigs, pubkeys));
+
+        msgs[3][0] ^= 0x01;
+        sigs[7][0] ^= 0x01;
+        BOOST_CHECK(!batch_verify<scheme_type>(msgs, sigs, pubkeys));
+
+        std::vector<std::size_t> invalid;
+        batch_verify<scheme_type>(msgs, sigs, pubkeys, std::back_inserter(invalid));
+        BOOST_CHECK((invalid == std::vector<std::size_t> {3, 7}));
+    }
+
+    BOOST_AUTO_TEST_CASE(eddsa_batch_verify_torsion_test) {
+        using curve_type = algebra::curves::ed25519;
+        using group_type = typename curve_type::g1_type<>;
+        using group_value_type = typename group_type::value_type;
+        using base_field_value_type = typename curve_type::base_field_type::value_type;
+        using scalar_field_type = typename curve_type::scalar_field_type;
+        using scalar_field_value_type = typename scalar_field_type::value_type;
+
+        using scheme_type = pubkey::eddsa<group_type, pubkey::eddsa_type::basic, void>;
+        using public_key_type = pubkey::public_key<scheme_type>;
+        using batch_item_type = typename public_key_type::batch_item_type;
+
+        random::algebraic_random_device<scalar_field_type> rnd;
+
+        // (0, -1) is the point of order 2
+        const group_value_type torsion(base_field_value_type::zero(), -base_field_value_type::one(),
+                                       base_field_value_type::zero(), base_field_value_type::one());
+        BOOST_CHECK(!torsion.is_zero());
+        BOOST_CHECK((torsion + torsion).is_zero());
+
+        std::vector<batch_item_type> items;
+        for (std::size_t i = 0; i < 8; ++i) {
+            const scalar_field_value_type a = rnd(), r = rnd();
+            batch_item_type item;
+            item.well_formed = true;
+            item.k = rnd();
+            item.A = a * group_value_type::one();
+            item.R = r * group_value_type::one();
+            item.S = r + item.k * a;
+            items.emplace_back(item);
+        }
+        BOOST_CHECK(public_key_type::batch_verify(items.begin(), items.end()));
+
+        // R + T only passes the cofactored equation, every batch must agree with the single check
+        items[5].R = items[5].R + torsion;
+        BOOST_CHECK(!(items[5].S * group_value_type::one() == items[5].R + items[5].k * items[5].A));
+        BOOST_CHECK(public_key_type::verify_item(items[5]));
+        BOOST_CHECK(public_key_type::batch_verify(items.begin() + 5, items.begin() + 6));
+        for (std::size_t i = 0; i < 16; ++i) {
+            BOOST_CHECK(public_key_type::batch_verify(items.begin(), items.end()));
+        }
+
+        items[5].S += scalar_field_value_type::one();
+        BOOST_CHECK(!public_key_type::verify_item(items[5]));
+        for (std::size_t i = 0; i < 16; ++i) {
+            BOOST_CHECK(!public_key_type::batch_verify(items.begin(), items.end()));
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
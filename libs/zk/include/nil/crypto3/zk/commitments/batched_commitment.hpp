@@ -36,6 +36,8 @@
 
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/algorithms/barycentric_evaluation.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
 
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
@@ -195,6 +197,15 @@ namespace nil {
                     }
 
                     void eval_polys() {
+                        using value_type = typename field_type::value_type;
+                        constexpr bool is_dfs = std::is_same<math::polynomial_dfs<value_type>, polynomial_type>::value;
+
+                        struct evaluation_type {
+                            std::size_t batch;
+                            std::size_t poly;
+                            std::size_t point;
+                        };
+                        std::vector<evaluation_type> evaluations;
                         for(auto const &[k, poly] : _polys) {
                             _z.set_batch_size(k, poly.size());
                             auto const &point = _points.at(k);
@@ -204,10 +215,42 @@ namespace nil {
                             for (std::size_t i = 0; i < poly.size(); ++i) {
                                 _z.set_poly_points_number(k, i, point[i].size());
                                 for (std::size_t j = 0; j < point[i].size(); j++) {
-                                    _z.set(k, i, j, poly[i].evaluate(point[i][j]));
+                                    evaluations.push_back({k, i, j});
                                 }
                             }
                         }
+
+                        // DFS polynomials share the barycentric weights of every (size, point) pair.
+                        math::barycentric_evaluator<field_type> evaluator;
+                        if constexpr (is_dfs) {
+                            for (auto const &e: evaluations) {
+                                std::size_t size = _polys.at(e.batch)[e.poly].size();
+                                if (math::detail::is_power_of_two(size)) {
+                                    evaluator.add(size, _points.at(e.batch)[e.poly][e.point]);
+                                }
+                            }
+                        }
+
+                        std::vector<value_type> values(evaluations.size());
+                        math::parallel_for(
+                            0, evaluations.size(),
+                            [this, &evaluations, &evaluator, &values](std::size_t n) {
+                                auto const &e = evaluations[n];
+                                auto const &poly = _polys.at(e.batch)[e.poly];
+                                auto const &point = _points.at(e.batch)[e.poly][e.point];
+                                if constexpr (is_dfs) {
+                                    if (math::detail::is_power_of_two(poly.size())) {
+                                        values[n] = evaluator.evaluate(poly, point);
+                                        return;
+                                    }
+                                }
+                                values[n] = poly.evaluate(point);
+                            },
+                            std::max<std::size_t>(2, math::worker_count()));
+
+                        for (std::size_t n = 0; n < evaluations.size(); n++) {
+                            _z.set(evaluations[n].batch, evaluations[n].poly, evaluations[n].point, values[n]);
+                        }
                     }
 
                 public:
@@ -30,6 +30,7 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_BASIC_FRI_HPP
 #define CRYPTO3_ZK_COMMITMENTS_BASIC_FRI_HPP
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <map>
@@ -41,6 +42,7 @@
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
+#include <nil/crypto3/math/algorithms/low_degree_extension.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
@@ -433,20 +435,40 @@ namespace nil {
                 static typename std::enable_if<
                         (std::is_same<typename ContainerType::value_type, math::polynomial_dfs<typename FRI::field_type::value_type>>::value),
                         typename FRI::precommitment_type>::type
-                precommit(ContainerType poly,
+                precommit(const ContainerType &poly,
                           std::shared_ptr<math::evaluation_domain<typename FRI::field_type>> D,
                           const std::size_t fri_step
                 ) {
                     PROFILE_PLACEHOLDER_SCOPE("Basic FRI Precommit time");
 
-                    for (std::size_t i = 0; i < poly.size(); ++i) {
-                        if (poly[i].size() != D->size()) {
-                            poly[i].resize(D->size(), nullptr, D);
-                        }
-                    }
+                    using value_type = typename FRI::field_type::value_type;
 
                     std::size_t domain_size = D->size();
                     std::size_t list_size = poly.size();
+
+                    // Polynomials given on smaller domains are extended together into one matrix,
+                    // the rest are read in place.
+                    std::vector<std::size_t> extended_indices;
+                    for (std::size_t i = 0; i < list_size; ++i) {
+                        if (poly[i].size() != domain_size) {
+                            extended_indices.push_back(i);
+                        }
+                    }
+                    std::vector<std::reference_wrapper<const math::polynomial_dfs<value_type>>> to_extend;
+                    for (std::size_t i : extended_indices) {
+                        to_extend.emplace_back(poly[i]);
+                    }
+                    std::vector<value_type> extended;
+                    math::low_degree_extension<typename FRI::field_type>(to_extend, domain_size, extended);
+
+                    std::vector<const value_type *> poly_values(list_size);
+                    for (std::size_t i = 0; i < list_size; ++i) {
+                        poly_values[i] = poly[i].size() == domain_size ? &poly[i][0] : nullptr;
+                    }
+                    for (std::size_t j = 0; j < extended_indices.size(); ++j) {
+                        poly_values[extended_indices[j]] = extended.data() + j * domain_size;
+                    }
+
                     std::size_t coset_size = 1 << fri_step;
                     std::size_t leafs_number = domain_size / coset_size;
                     std::vector<detail::fri_field_element_consumer<FRI>> y_data(
@@ -461,8 +483,8 @@ namespace nil {
                             s_indices[0][0] = x_index;
                             s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
 
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
+                            element_consumer.consume(poly_values[polynom_index][s_indices[0][0]]);
+                            element_consumer.consume(poly_values[polynom_index][s_indices[0][1]]);
 
                             std::size_t base_index = domain_size / (FRI::m * FRI::m);
                             std::size_t prev_half_size = 1;
@@ -471,8 +493,8 @@ namespace nil {
                                 for (std::size_t j = 0; j < prev_half_size; j++) {
                                     s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
                                     s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
+                                    element_consumer.consume(poly_values[polynom_index][s_indices[i][0]]);
+                                    element_consumer.consume(poly_values[polynom_index][s_indices[i][1]]);
 
                                     i++;
                                 }
@@ -770,12 +792,7 @@ namespace nil {
                         std::size_t domain_size = fri_params.D[0]->size();
                         typename FRI::field_type::value_type x = transcript.template challenge<typename FRI::field_type>();
                         x = x.pow((FRI::field_type::modulus - 1) / domain_size);
-                        std::uint64_t x_index = 0;
-                        for (x_index = 0; x_index < domain_size; x_index++) {
-                            if (fri_params.D[0]->get_domain_element(x_index) == x) {
-                                break;
-                            }
-                        }
+                        std::uint64_t x_index = fri_params.D[0]->get_domain_element_index(x);
                         t = 0;
 
                         std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
@@ -973,12 +990,7 @@ namespace nil {
                         typename FRI::field_type::value_type x_challenge = transcript.template challenge<typename FRI::field_type>();
                         typename FRI::field_type::value_type x = x_challenge.pow(
                                 (FRI::field_type::modulus - 1) / domain_size);
-                        std::uint64_t x_index = 0;
-                        for (x_index = 0; x_index < domain_size; x_index++) {
-                            if (fri_params.D[0]->get_domain_element(x_index) == x) {
-                                break;
-                            }
-                        }
+                        std::uint64_t x_index = fri_params.D[0]->get_domain_element_index(x);
 
                         std::vector<std::array<typename FRI::field_type::value_type, FRI::m>> s;
                         std::vector<std::array<std::size_t, FRI::m>> s_indices;
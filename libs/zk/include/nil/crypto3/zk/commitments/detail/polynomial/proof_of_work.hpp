@@ -28,8 +28,13 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <limits>
+#include <utility>
 
+#include <nil/crypto3/math/parallelization.hpp>
 #include <nil/crypto3/random/algebraic_engine.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
@@ -38,12 +43,73 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace commitments {
+                namespace detail {
+                    template<typename NonceType>
+                    struct grinding_result {
+                        NonceType proof_of_work;
+                        // Total number of nonces hashed by all workers, including the ones checked
+                        // speculatively after the winning nonce was found.
+                        std::size_t attempts;
+                    };
+
+                    /*!
+                     * @brief Searches nonces 0, 1, 2, ... for the smallest one accepted by Check.
+                     *
+                     * The nonce space is handed out to workers in consecutive batches. A worker stops as soon as
+                     * it hits a valid nonce, and no new batch is started past the best nonce found so far, so every
+                     * nonce below the result has been rejected and the result does not depend on the thread count.
+                     * Check is called as check(worker_state, nonce) where worker_state is a per-worker copy of
+                     * state. With MULTICORE, math::worker_count() workers are used.
+                     */
+                    template<typename WorkerState, typename Check>
+                    std::pair<std::uint64_t, std::size_t> grind_smallest_nonce(const WorkerState &state,
+                                                                               std::uint64_t max_nonce,
+                                                                               Check check) {
+                        constexpr static const std::uint64_t batch_size = 1 << 10;
+                        constexpr static const std::uint64_t not_found = std::numeric_limits<std::uint64_t>::max();
+
+                        std::atomic<std::uint64_t> next_batch(0);
+                        std::atomic<std::uint64_t> found(not_found);
+                        std::atomic<std::size_t> attempts(0);
+
+#ifdef MULTICORE
+#pragma omp parallel num_threads(math::worker_count())
+#endif
+                        {
+                            WorkerState worker_state = state;
+                            std::size_t worker_attempts = 0;
+
+                            while (true) {
+                                const std::uint64_t first = next_batch.fetch_add(1) * batch_size;
+                                if (first > max_nonce || first > found.load()) {
+                                    break;
+                                }
+                                const std::uint64_t last = std::min(max_nonce - first, batch_size - 1) + first;
+                                for (std::uint64_t nonce = first; nonce <= last; ++nonce) {
+                                    ++worker_attempts;
+                                    if (check(worker_state, nonce)) {
+                                        std::uint64_t best = found.load();
+                                        while (nonce < best && !found.compare_exchange_weak(best, nonce)) {
+                                        }
+                                        break;
+                                    }
+                                }
+                            }
+                            attempts += worker_attempts;
+                        }
+
+                        BOOST_ASSERT_MSG(found.load() != not_found, "Proof of work nonce space exhausted");
+                        return {found.load(), attempts.load()};
+                    }
+                }    // namespace detail
+
                 template<typename TranscriptHashType, typename OutType = std::uint32_t>
                 class proof_of_work {
                 public:
                     using transcript_hash_type = TranscriptHashType;
                     using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
                     using output_type = OutType;
+                    using grinding_result = detail::grinding_result<output_type>;
 
                     static inline std::array<std::uint8_t, sizeof(OutType)>
                         to_byte_array(OutType v) {
@@ -55,22 +121,30 @@ namespace nil {
                             return bytes;
                         }
 
-                    static inline OutType generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
+                    /*!
+                     * @brief Finds the smallest nonce passing verify() without modifying the transcript.
+                     * Every nonce is fed as bytes on top of the transcript midstate. For the hash based transcript
+                     * the midstate only buffers the previous digest, which is shorter than a block, so this saves
+                     * feeding the state again but no compression.
+                     */
+                    static inline grinding_result grind(const transcript_type &transcript, std::size_t GrindingBits = 16) {
                         BOOST_ASSERT_MSG(GrindingBits < 64, "Grinding parameter should be bits, not mask");
-                        output_type mask = GrindingBits > 0 ? ( 1ULL << GrindingBits ) - 1 : 0;
-                        output_type proof_of_work = std::rand();
-                        output_type result;
-
-                        while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(to_byte_array(proof_of_work));
-                            result = tmp_transcript.template int_challenge<output_type>();
-                            if ((result & mask) == 0)
-                                break;
-                            proof_of_work++;
-                        }
+                        const output_type mask = GrindingBits > 0 ? ( 1ULL << GrindingBits ) - 1 : 0;
+                        const typename transcript_type::midstate_type midstate = transcript.midstate();
+
+                        auto found = detail::grind_smallest_nonce(
+                            transcript, std::numeric_limits<output_type>::max(),
+                            [&midstate, mask](transcript_type &tmp_transcript, std::uint64_t nonce) {
+                                tmp_transcript.absorb(midstate, to_byte_array(static_cast<output_type>(nonce)));
+                                return (tmp_transcript.template int_challenge<output_type>() & mask) == 0;
+                            });
+                        return {static_cast<output_type>(found.first), found.second};
+                    }
+
+                    static inline OutType generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
+                        output_type proof_of_work = grind(transcript, GrindingBits).proof_of_work;
                         transcript(to_byte_array(proof_of_work));
-                        result = transcript.template int_challenge<output_type>();
+                        transcript.template int_challenge<output_type>();
                         return proof_of_work;
                     }
 
@@ -94,28 +168,37 @@ namespace nil {
                     using transcript_type = transcript::fiat_shamir_heuristic_sequential<transcript_hash_type>;
                     using value_type = typename FieldType::value_type;
                     using integral_type = typename FieldType::integral_type;
-
-                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
-                        static boost::random::random_device dev;
-                        static nil::crypto3::random::algebraic_engine<FieldType> random_engine(dev);
-                        value_type proof_of_work = random_engine();
-                        integral_type result;
-
-                        integral_type mask =
+                    using grinding_result = detail::grinding_result<value_type>;
+
+                    /*!
+                     * @brief Finds the smallest nonce passing verify() without modifying the transcript.
+                     * Every nonce is absorbed as a field element into a copy of the transcript midstate. For the
+                     * Poseidon transcript the midstate is the sponge itself, so a nonce costs one absorb and the
+                     * permutation of the squeeze, and nothing absorbed before is replayed. Other transcripts
+                     * marshal the element and hash it after their buffered digest.
+                     */
+                    static inline grinding_result grind(const transcript_type &transcript, std::size_t GrindingBits = 16) {
+                        const integral_type mask =
                             (GrindingBits > 0 ?
                                 ((integral_type(1) << GrindingBits) - 1) << (FieldType::modulus_bits - GrindingBits)
                                 : 0);
+                        const typename transcript_type::midstate_type midstate = transcript.midstate();
+
+                        auto found = detail::grind_smallest_nonce(
+                            transcript, std::numeric_limits<std::uint64_t>::max(),
+                            [&midstate, &mask](transcript_type &tmp_transcript, std::uint64_t nonce) {
+                                tmp_transcript.absorb(midstate, value_type(nonce));
+                                integral_type result =
+                                    integral_type(tmp_transcript.template challenge<FieldType>().data);
+                                return (result & mask) == 0;
+                            });
+                        return {value_type(found.first), found.second};
+                    }
 
-                        while( true ) {
-                            transcript_type tmp_transcript = transcript;
-                            tmp_transcript(proof_of_work);
-                            result = integral_type(tmp_transcript.template challenge<FieldType>().data);
-                            if ((result & mask) == 0)
-                                break;
-                            proof_of_work++;
-                        }
+                    static inline value_type generate(transcript_type &transcript, std::size_t GrindingBits = 16) {
+                        value_type proof_of_work = grind(transcript, GrindingBits).proof_of_work;
                         transcript(proof_of_work);
-                        result = integral_type(transcript.template challenge<FieldType>().data);
+                        transcript.template challenge<FieldType>();
                         return proof_of_work;
                     }
 
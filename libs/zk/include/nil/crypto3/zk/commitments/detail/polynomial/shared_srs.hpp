@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ZK_COMMITMENTS_SHARED_SRS_HPP
+#define CRYPTO3_ZK_COMMITMENTS_SHARED_SRS_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace commitments {
+                namespace detail {
+                    /**
+                     * @brief Immutable sequence of points of a structured reference string.
+                     *
+                     * The points are allocated once and owned by a reference counter, copies only share them.
+                     * Commitment params holding a key of millions of points are thus cheap to copy, to store
+                     * in every commitment scheme instance and to read from several threads at once.
+                     * Reads like a const std::vector and converts to one without copying.
+                     */
+                    template<typename ValueType>
+                    class shared_srs {
+                    public:
+                        typedef ValueType value_type;
+                        typedef std::vector<value_type> container_type;
+                        typedef typename container_type::size_type size_type;
+                        typedef typename container_type::const_reference const_reference;
+                        typedef const_reference reference;
+                        typedef typename container_type::const_iterator const_iterator;
+                        typedef const_iterator iterator;
+
+                        shared_srs() : shared_srs(container_type()) {
+                        }
+
+                        shared_srs(container_type points) :
+                            _points(std::make_shared<const container_type>(std::move(points))) {
+                        }
+
+                        shared_srs(std::initializer_list<value_type> points) : shared_srs(container_type(points)) {
+                        }
+
+                        const container_type &points() const {
+                            return *_points;
+                        }
+
+                        operator const container_type &() const {
+                            return *_points;
+                        }
+
+                        const_iterator begin() const {
+                            return _points->begin();
+                        }
+
+                        const_iterator end() const {
+                            return _points->end();
+                        }
+
+                        const_iterator cbegin() const {
+                            return _points->cbegin();
+                        }
+
+                        const_iterator cend() const {
+                            return _points->cend();
+                        }
+
+                        size_type size() const {
+                            return _points->size();
+                        }
+
+                        bool empty() const {
+                            return _points->empty();
+                        }
+
+                        const_reference operator[](size_type i) const {
+                            BOOST_ASSERT(i < _points->size());
+                            return (*_points)[i];
+                        }
+
+                        const_reference front() const {
+                            return _points->front();
+                        }
+
+                        const_reference back() const {
+                            return _points->back();
+                        }
+
+                        /// @brief Whether both refer to the same allocation, as copies of one another do.
+                        bool shares_points_with(const shared_srs &other) const {
+                            return _points == other._points;
+                        }
+
+                        bool operator==(const shared_srs &other) const {
+                            return shares_points_with(other) || *_points == *other._points;
+                        }
+
+                        bool operator!=(const shared_srs &other) const {
+                            return !(*this == other);
+                        }
+
+                    private:
+                        std::shared_ptr<const container_type> _points;
+                    };
+                }    // namespace detail
+            }        // namespace commitments
+        }            // namespace zk
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_COMMITMENTS_SHARED_SRS_HPP
@@ -47,6 +47,7 @@
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 #include <nil/crypto3/algebra/marshalling.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
 #include <nil/crypto3/hash/block_to_field_elements_wrapper.hpp>
 
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
@@ -55,6 +56,7 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 #include <nil/crypto3/zk/commitments/batched_commitment.hpp>
+#include <nil/crypto3/zk/commitments/detail/polynomial/shared_srs.hpp>
 
 using namespace nil::crypto3::math;
 
@@ -77,7 +79,7 @@ namespace nil {
                     typedef CurveType curve_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = std::vector<typename curve_type::template g1_type<>::value_type>;
@@ -85,41 +87,35 @@ namespace nil {
                     using commitment_type = typename curve_type::template g1_type<>::value_type;
                     using proof_type = commitment_type;
 
+                    // The commitment key is shared between copies, params are passed around without copying it.
                     struct params_type {
                         using commitment_type = typename curve_type::template g1_type<>::value_type;
                         using field_type = typename curve_type::scalar_field_type;
                         using params_single_commitment_type = single_commitment_type;
                         using params_verification_key_type = verification_key_type;
 
-                        single_commitment_type commitment_key;
+                        detail::shared_srs<commitment_type> commitment_key;
                         verification_key_type verification_key;
 
                         params_type() {
                         }
 
-                        params_type(std::size_t d) {
-                            auto alpha = algebra::random_element<field_type>();
-                            verification_key = verification_key_type::one() * alpha;
-                            commitment_key.resize(d);
-                            auto alpha_com = commitment_type::one();
-                            for (std::size_t i = 0; i < d; i++) {
-                                commitment_key[i] = alpha_com;
-                                alpha_com = alpha * alpha_com;
-                            }
+                        params_type(std::size_t d) : params_type(d, algebra::random_element<field_type>()) {
                         }
 
                         params_type(std::size_t d, scalar_value_type alpha) {
-                            verification_key = verification_key_type::one() * alpha;
-                            commitment_key.resize(d);
+                            verification_key = algebra::generator_mul<typename curve_type::template g2_type<>>(alpha);
+                            single_commitment_type ck(d);
                             auto alpha_com = commitment_type::one();
                             for (std::size_t i = 0; i < d; i++) {
-                                commitment_key[i] = alpha_com;
+                                ck[i] = alpha_com;
                                 alpha_com = alpha * alpha_com;
                             }
+                            commitment_key = std::move(ck);
                         }
 
-                        params_type(single_commitment_type ck, verification_key_type vk) : commitment_key(ck),
-                            verification_key(vk) {
+                        params_type(detail::shared_srs<commitment_type> ck, verification_key_type vk) :
+                            commitment_key(std::move(ck)), verification_key(vk) {
                         }
                     };
 
@@ -163,7 +159,7 @@ namespace nil {
                                  CommitmentSchemeType>::value,
                              bool>::type = true>
                 static typename CommitmentSchemeType::proof_type
-                proof_eval(typename CommitmentSchemeType::params_type params,
+                proof_eval(const typename CommitmentSchemeType::params_type &params,
                            const typename math::polynomial<typename CommitmentSchemeType::scalar_value_type> &f,
                            typename CommitmentSchemeType::scalar_value_type z) {
                     // We need two scopes on the next line to force it to use the initializer list version,
@@ -191,7 +187,7 @@ namespace nil {
                                  CommitmentSchemeType>::value,
                              bool>::type = true>
                 static typename CommitmentSchemeType::proof_type
-                proof_eval(typename CommitmentSchemeType::params_type params,
+                proof_eval(const typename CommitmentSchemeType::params_type &params,
                            const typename math::polynomial<typename CommitmentSchemeType::scalar_value_type> &f,
                            typename CommitmentSchemeType::public_key_type &pk) {
                     return proof_eval<CommitmentSchemeType>(params, f, pk.z);
@@ -209,10 +205,11 @@ namespace nil {
                     auto A_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(proof);
                     auto A_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
                         params.verification_key -
-                        public_key.z *
-                        CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
+                        algebra::generator_mul<typename CommitmentSchemeType::curve_type::template g2_type<>>(
+                            public_key.z));
                     auto B_1 = algebra::precompute_g1<typename CommitmentSchemeType::curve_type>(
-                        public_key.eval * CommitmentSchemeType::curve_type::template g1_type<>::value_type::one() -
+                        algebra::generator_mul<typename CommitmentSchemeType::curve_type::template g1_type<>>(
+                            public_key.eval) -
                         public_key.commit);
                     auto B_2 = algebra::precompute_g2<typename CommitmentSchemeType::curve_type>(
                         CommitmentSchemeType::curve_type::template g2_type<>::value_type::one());
@@ -249,7 +246,7 @@ namespace nil {
                     typedef TranscriptHashType transcript_hash_type;
                     typedef typename curve_type::gt_type::value_type gt_value_type;
 
-                    using multiexp_method = typename algebra::policies::multiexp_method_BDLO12;
+                    using multiexp_method = typename algebra::policies::multiexp_method_pippenger;
                     using field_type = typename curve_type::scalar_field_type;
                     using scalar_value_type = typename curve_type::scalar_field_type::value_type;
                     using single_commitment_type = typename curve_type::template g1_type<>::value_type;
@@ -271,58 +268,44 @@ namespace nil {
                         single_commitment_type kzg_proof;
                     };
 
+                    // Both keys are shared between copies, so the scheme and every prover or verifier holding
+                    // the params read the same points.
                     struct params_type {
                         using commitment_type = std::vector<std::uint8_t>;
                         using field_type = typename curve_type::scalar_field_type;
 
-                        std::vector<single_commitment_type> commitment_key;
-                        std::vector<verification_key_type> verification_key;
+                        detail::shared_srs<single_commitment_type> commitment_key;
+                        detail::shared_srs<verification_key_type> verification_key;
                         using params_single_commitment_type = commitment_type;
 
                         params_type() {
                         };
 
-                        params_type(std::size_t d, std::size_t t) {
-                            auto alpha = algebra::random_element<typename curve_type::scalar_field_type>();
-                            commitment_key.resize(d);
-                            verification_key.resize(t + 1);
-                            auto alpha_comm = single_commitment_type::one();
-                            for (std::size_t i = 0; i < d; ++i) {
-                                commitment_key[i] = alpha_comm;
-                                alpha_comm *= alpha;
-                            }
-                            auto alpha_ver = verification_key_type::one();
-                            for (std::size_t i = 0; i <= t; ++i) {
-                                verification_key[i] = alpha_ver;
-                                alpha_ver *= alpha;
-                            }
+                        params_type(std::size_t d, std::size_t t) :
+                            params_type(d, t, algebra::random_element<typename curve_type::scalar_field_type>()) {
                         }
 
                         params_type(std::size_t d, std::size_t t, scalar_value_type alpha) {
-                            commitment_key.resize(d);
-                            verification_key.resize(t + 1);
+                            std::vector<single_commitment_type> ck(d);
+                            std::vector<verification_key_type> vk(t + 1);
                             auto alpha_comm = single_commitment_type::one();
                             for (std::size_t i = 0; i < d; ++i) {
-                                commitment_key[i] = alpha_comm;
+                                ck[i] = alpha_comm;
                                 alpha_comm = alpha * alpha_comm;
                             }
                             auto alpha_ver = verification_key_type::one();
                             for (std::size_t i = 0; i <= t; ++i) {
-                                verification_key[i] = alpha_ver;
+                                vk[i] = alpha_ver;
                                 alpha_ver = alpha * alpha_ver;
                             }
+                            commitment_key = std::move(ck);
+                            verification_key = std::move(vk);
                         }
 
-                        params_type(std::vector<single_commitment_type> commitment_key,
-                                    std::vector<verification_key_type> verification_key) : commitment_key(
-                                commitment_key), verification_key(verification_key) {
+                        params_type(detail::shared_srs<single_commitment_type> commitment_key,
+                                    detail::shared_srs<verification_key_type> verification_key) :
+                            commitment_key(std::move(commitment_key)), verification_key(std::move(verification_key)) {
                         };
-
-                        params_type operator=(const params_type &other) {
-                            commitment_key = other.commitment_key;
-                            verification_key = other.verification_key;
-                            return *this;
-                        }
                     };
 
                     struct public_key_type {
@@ -513,7 +496,7 @@ namespace nil {
                                  CommitmentSchemeType>::value,
                              bool>::type = true>
                 static typename CommitmentSchemeType::verification_key_type commit_g2(
-                    typename CommitmentSchemeType::params_type &params,
+                    const typename CommitmentSchemeType::params_type &params,
                     typename math::polynomial<typename CommitmentSchemeType::scalar_value_type> poly) {
                     BOOST_ASSERT(poly.size() <= params.verification_key.size());
                     typename CommitmentSchemeType::verification_key_type result;
@@ -627,7 +610,7 @@ namespace nil {
                                      CommitmentSchemeType::polynomial_type>,
                                  CommitmentSchemeType>::value,
                              bool>::type = true>
-                static bool verify_eval(typename CommitmentSchemeType::params_type params,
+                static bool verify_eval(const typename CommitmentSchemeType::params_type &params,
                                         const typename CommitmentSchemeType::single_commitment_type &proof,
                                         const typename CommitmentSchemeType::public_key_type &public_key,
                                         typename CommitmentSchemeType::transcript_type &transcript) {
@@ -761,7 +744,7 @@ namespace nil {
                     void mark_batch_as_fixed(std::size_t index) {
                     }
 
-                    kzg_commitment_scheme(params_type kzg_params) : _params(kzg_params) {
+                    kzg_commitment_scheme(params_type kzg_params) : _params(std::move(kzg_params)) {
                     }
 
                     // Differs from static, because we pack the result into byte blob.
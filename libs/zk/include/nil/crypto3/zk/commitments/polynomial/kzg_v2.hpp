@@ -47,6 +47,7 @@
 #include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
 #include <nil/crypto3/algebra/marshalling.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/generator_mul.hpp>
 
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
 
@@ -183,8 +184,8 @@ namespace nil {
                         return params_type(d, 1, alpha);
                     }
 
-                    kzg_commitment_scheme_v2(params_type kzg_params) : _params(kzg_params) {
-                        BOOST_ASSERT(kzg_params.verification_key.size() == 2);
+                    kzg_commitment_scheme_v2(params_type kzg_params) : _params(std::move(kzg_params)) {
+                        BOOST_ASSERT(_params.verification_key.size() == 2);
                     }
 
                     // Differs from static, because we pack the result into byte blob.
@@ -331,7 +332,7 @@ namespace nil {
                             }
                         }
 
-                        F -= rsum * CommitmentSchemeType::single_commitment_type::one();
+                        F -= algebra::generator_mul<typename curve_type::template g1_type<>>(rsum);
                         F -= this->get_V(_merged_points).evaluate(theta_2) * proof.pi_1;
 
                         auto left_side_pairing = nil::crypto3::algebra::pair_reduced<typename CommitmentSchemeType::curve_type>
@@ -30,8 +30,15 @@
 #ifndef CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_LIST_POLYNOMIAL_COMMITMENT_SCHEME_HPP
 
+#include <functional>
+
+#include <nil/crypto3/algebra/batch_inversion.hpp>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/algorithms/barycentric_evaluation.hpp>
+#include <nil/crypto3/math/algorithms/low_degree_extension.hpp>
+#include <nil/crypto3/math/parallelization.hpp>
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
@@ -74,57 +81,12 @@ namespace nil {
                     std::map<std::size_t, bool> _batch_fixed;
                     preprocessed_data_type _fixed_polys_values;
 
-                public:
-                    lpc_commitment_scheme(const typename fri_type::params_type &fri_params)
-                        : _fri_params(fri_params), _etha(0u) {
-                    }
-
-                    preprocessed_data_type preprocess(transcript_type& transcript) const{
-                        auto etha = transcript.template challenge<field_type>();
-
-                        preprocessed_data_type result;
-                        for(auto const&[index, fixed]: _batch_fixed) {
-                            if(!fixed) continue;
-                            result[index] = {};
-                            for (const auto& poly: this->_polys.at(index)){
-                                result[index].push_back(poly.evaluate(etha));
-                            }
-                        }
-                        return result;
-                    }
-
-                    void setup(transcript_type& transcript, const preprocessed_data_type &preprocessed_data) {
-                        _etha = transcript.template challenge<field_type>();
-                        _fixed_polys_values = preprocessed_data;
-                    }
-
-                    commitment_type commit(std::size_t index) {
-                        this->state_commited(index);
-                        _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
-                            this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
-                        return _trees[index].root();
-                    }
-
-                    // Should be done after commitment.
-                    void mark_batch_as_fixed(std::size_t index) {
-                        _batch_fixed[index] = true;
-                    }
-
-                    proof_type proof_eval(transcript_type &transcript) {
-
-                        this->eval_polys();
-
-                        BOOST_ASSERT(this->_points.size() == this->_polys.size());
-                        BOOST_ASSERT(this->_points.size() == this->_z.get_batches_num());
-
-                        for(auto const& it: this->_trees) {
-                            transcript(it.second.root());
-                        }
-
-                        // Prepare z-s and combined_Q;
-                        auto theta = transcript.template challenge<field_type>();
+                    /**
+                     * @brief Computes the coefficients of combined_Q = sum_k theta^k (g_k(x) - z_k) / (x - point_k)
+                     * by polynomial long division.
+                     */
+                    math::polynomial<value_type> combined_Q_coefficients(const value_type &theta) {
                         typename field_type::value_type theta_acc = field_type::value_type::one();
-                        polynomial_type combined_Q;
                         math::polynomial<value_type> V;
 
                         auto points = this->get_unique_points();
@@ -173,11 +135,211 @@ namespace nil {
                             Q_normal = Q_normal / V;
                             combined_Q_normal += Q_normal;
                         }
+                        return combined_Q_normal;
+                    }
 
+                    /**
+                     * @brief Computes the same combined_Q by its values on D[0], which is what FRI commits to.
+                     *
+                     * Every column is extended to D[0] once, the numerators of all the columns opened at the same
+                     * point are summed up there, and then divided by (x - point) with one batch inversion per chunk
+                     * of D[0]. No inverse FFT of the columns and no long division is needed.
+                     * Points lying in D[0] are left to combined_Q_coefficients, x - point vanishes there.
+                     */
+                    math::polynomial_dfs<value_type> combined_Q_evaluations(const value_type &theta) {
+                        const auto &domain = _fri_params.D[0];
+                        const std::size_t domain_size = domain->size();
+
+                        std::vector<value_type> points = this->get_unique_points();
+                        const std::size_t unique_points_amount = points.size();
+                        bool has_fixed_batches = false;
+                        for(std::size_t i: this->_z.get_batches()){
+                            has_fixed_batches = has_fixed_batches || _batch_fixed[i];
+                        }
+                        if (has_fixed_batches) {
+                            points.push_back(_etha);
+                        }
+                        for (auto const &point: points) {
+                            if (point.pow(domain_size) == value_type::one()) {
+                                math::polynomial_dfs<value_type> result;
+                                result.from_coefficients(combined_Q_coefficients(theta));
+                                return result;
+                            }
+                        }
+
+                        // Theta powers are assigned in the same order as in combined_Q_coefficients,
+                        // the verifier relies on it. terms[i][j] lists the points column j of batch i is opened at.
+                        struct term_type {
+                            std::size_t point;
+                            value_type theta_power;
+                        };
+                        std::map<std::size_t, std::vector<std::vector<term_type>>> terms;
+                        std::vector<value_type> evaluations_sum(points.size(), value_type::zero());
+                        value_type theta_acc = value_type::one();
+                        for(std::size_t i: this->_z.get_batches()){
+                            terms[i].resize(this->_z.get_batch_size(i));
+                        }
+
+                        for (std::size_t p = 0; p < unique_points_amount; p++){
+                            for(std::size_t i: this->_z.get_batches()){
+                                for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++){
+                                    auto it = std::find(this->_points[i][j].begin(), this->_points[i][j].end(), points[p]);
+                                    if( it == this->_points[i][j].end()) continue;
+                                    terms[i][j].push_back({p, theta_acc});
+                                    evaluations_sum[p] += this->_z.get(i, j, it - this->_points[i][j].begin()) * theta_acc;
+                                    theta_acc *= theta;
+                                }
+                            }
+                        }
+                        for(std::size_t i: this->_z.get_batches()){
+                            if( !_batch_fixed[i] )continue;
+                            for(std::size_t j = 0; j < this->_z.get_batch_size(i); j++){
+                                terms[i][j].push_back({unique_points_amount, theta_acc});
+                                evaluations_sum[unique_points_amount] += _fixed_polys_values[i][j] * theta_acc;
+                                theta_acc *= theta;
+                            }
+                        }
+
+                        // numerators[p] = sum of theta^k g_k over the columns opened at points[p], on D[0].
+                        std::vector<std::vector<value_type>> numerators(
+                            points.size(), std::vector<value_type>(domain_size, value_type::zero()));
+                        std::size_t degree = 0;
+                        for (auto const &[i, batch_terms]: terms) {
+                            auto const &batch = this->_polys.at(i);
+
+                            // Columns given on smaller domains are extended together, the rest are read in place.
+                            std::vector<std::size_t> extended_indices;
+                            std::vector<std::reference_wrapper<const math::polynomial_dfs<value_type>>> to_extend;
+                            for (std::size_t j = 0; j < batch_terms.size(); j++) {
+                                if (!batch_terms[j].empty() && batch[j].size() != domain_size) {
+                                    extended_indices.push_back(j);
+                                    to_extend.emplace_back(batch[j]);
+                                }
+                            }
+                            std::vector<value_type> extended;
+                            math::low_degree_extension<field_type>(to_extend, domain_size, extended);
+
+                            std::vector<const value_type *> values(batch_terms.size(), nullptr);
+                            for (std::size_t j = 0; j < batch_terms.size(); j++) {
+                                if (!batch_terms[j].empty() && batch[j].size() == domain_size) {
+                                    values[j] = &batch[j][0];
+                                }
+                            }
+                            for (std::size_t k = 0; k < extended_indices.size(); k++) {
+                                values[extended_indices[k]] = extended.data() + k * domain_size;
+                            }
+
+                            for (std::size_t j = 0; j < batch_terms.size(); j++) {
+                                if (batch_terms[j].empty()) continue;
+                                degree = std::max(degree, batch[j].degree());
+                                for (auto const &term: batch_terms[j]) {
+                                    auto &numerator = numerators[term.point];
+                                    const value_type *column = values[j];
+                                    math::parallel_for(0, domain_size, [&numerator, column, &term](std::size_t x) {
+                                        numerator[x] += term.theta_power * column[x];
+                                    });
+                                }
+                            }
+                        }
+
+                        // combined_Q(x) = sum_p (numerators[p](x) - evaluations_sum[p]) / (x - points[p]).
+                        math::polynomial_dfs<value_type> combined_Q(
+                            degree > 0 ? degree - 1 : 0, domain_size, value_type::zero());
+                        const value_type omega = domain->get_domain_element(1);
+                        const std::size_t chunks_amount = std::min(std::max<std::size_t>(math::worker_count(), 1),
+                                                                   domain_size);
+                        const std::size_t chunk_size = (domain_size + chunks_amount - 1) / chunks_amount;
+                        math::parallel_for(
+                            0, chunks_amount,
+                            [&](std::size_t c) {
+                                const std::size_t begin = c * chunk_size;
+                                const std::size_t end = std::min(begin + chunk_size, domain_size);
+                                if (begin >= end) {
+                                    return;
+                                }
+                                std::vector<value_type> elements(end - begin);
+                                elements[0] = omega.pow(begin);
+                                for (std::size_t k = 1; k < elements.size(); k++) {
+                                    elements[k] = elements[k - 1] * omega;
+                                }
+                                std::vector<value_type> denominators(end - begin);
+                                for (std::size_t p = 0; p < points.size(); p++) {
+                                    for (std::size_t k = 0; k < elements.size(); k++) {
+                                        denominators[k] = elements[k] - points[p];
+                                    }
+                                    algebra::batch_invert(denominators);
+                                    for (std::size_t k = 0; k < elements.size(); k++) {
+                                        combined_Q[begin + k] +=
+                                            (numerators[p][begin + k] - evaluations_sum[p]) * denominators[k];
+                                    }
+                                }
+                            },
+                            2);
+                        return combined_Q;
+                    }
+
+                public:
+                    lpc_commitment_scheme(const typename fri_type::params_type &fri_params)
+                        : _fri_params(fri_params), _etha(0u) {
+                    }
+
+                    preprocessed_data_type preprocess(transcript_type& transcript) const{
+                        auto etha = transcript.template challenge<field_type>();
+
+                        preprocessed_data_type result;
+                        math::barycentric_evaluator<field_type> evaluator;
+                        for(auto const&[index, fixed]: _batch_fixed) {
+                            if(!fixed) continue;
+                            result[index] = {};
+                            for (const auto& poly: this->_polys.at(index)){
+                                if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
+                                    if (math::detail::is_power_of_two(poly.size())) {
+                                        evaluator.add(poly.size(), etha);
+                                        result[index].push_back(evaluator.evaluate(poly, etha));
+                                        continue;
+                                    }
+                                }
+                                result[index].push_back(poly.evaluate(etha));
+                            }
+                        }
+                        return result;
+                    }
+
+                    void setup(transcript_type& transcript, const preprocessed_data_type &preprocessed_data) {
+                        _etha = transcript.template challenge<field_type>();
+                        _fixed_polys_values = preprocessed_data;
+                    }
+
+                    commitment_type commit(std::size_t index) {
+                        this->state_commited(index);
+                        _trees[index] = nil::crypto3::zk::algorithms::precommit<fri_type>(
+                            this->_polys[index], _fri_params.D[0], _fri_params.step_list.front());
+                        return _trees[index].root();
+                    }
+
+                    // Should be done after commitment.
+                    void mark_batch_as_fixed(std::size_t index) {
+                        _batch_fixed[index] = true;
+                    }
+
+                    proof_type proof_eval(transcript_type &transcript) {
+
+                        this->eval_polys();
+
+                        BOOST_ASSERT(this->_points.size() == this->_polys.size());
+                        BOOST_ASSERT(this->_points.size() == this->_z.get_batches_num());
+
+                        for(auto const& it: this->_trees) {
+                            transcript(it.second.root());
+                        }
+
+                        // Prepare z-s and combined_Q;
+                        auto theta = transcript.template challenge<field_type>();
+                        polynomial_type combined_Q;
                         if constexpr (std::is_same<math::polynomial_dfs<value_type>, PolynomialType>::value ) {
-                            combined_Q.from_coefficients(combined_Q_normal);
+                            combined_Q = combined_Q_evaluations(theta);
                         } else {
-                            combined_Q = std::move(combined_Q_normal);
+                            combined_Q = combined_Q_coefficients(theta);
                         }
 
                         precommitment_type combined_Q_precommitment = nil::crypto3::zk::algorithms::precommit<fri_type>(
@@ -0,0 +1,341 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+#define CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <nil/crypto3/zk/math/expression.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * An expression compiled into a flat list of instructions over a small register file.
+             *
+             * Common subexpressions are computed once, and registers are reused as soon as
+             * their value is no longer needed, so evaluating the expression at a point takes
+             * register_count() field elements of scratch space regardless of the expression size.
+             * Variables are numbered in the order returned by variables().
+             */
+            template<typename VariableType>
+            class compiled_expression {
+            public:
+                using variable_type = VariableType;
+                using value_type = typename VariableType::assignment_type;
+
+                enum class operand_kind : std::uint8_t { reg, variable, constant };
+
+                struct operand {
+                    operand_kind kind;
+                    std::uint32_t index;
+                };
+
+                enum class operation : std::uint8_t { add, sub, mul, pow };
+
+                struct instruction {
+                    operation op;
+                    std::uint32_t dst;
+                    operand lhs;
+                    // For pow rhs.index holds the power.
+                    operand rhs;
+                };
+
+                compiled_expression(const math::expression<VariableType> &expr) {
+                    compiler c(*this);
+                    _result = c.compile(expr);
+                    allocate_registers();
+                }
+
+                const std::vector<variable_type> &variables() const {
+                    return _variables;
+                }
+
+                const std::vector<instruction> &instructions() const {
+                    return _instructions;
+                }
+
+                std::size_t register_count() const {
+                    return _register_count;
+                }
+
+                /**
+                 * Evaluates the expression at a single point.
+                 * @param get_variable_value - returns the value of the variable with the given number.
+                 * @param registers - scratch space of at least register_count() elements.
+                 */
+                template<typename GetVariableValue>
+                value_type evaluate(GetVariableValue &&get_variable_value, std::vector<value_type> &registers) const {
+                    auto fetch = [this, &get_variable_value, &registers](const operand &o) -> value_type {
+                        switch (o.kind) {
+                            case operand_kind::reg:
+                                return registers[o.index];
+                            case operand_kind::variable:
+                                return get_variable_value(o.index);
+                            default:
+                                return _constants[o.index];
+                        }
+                    };
+
+                    for (const instruction &ins : _instructions) {
+                        switch (ins.op) {
+                            case operation::add:
+                                registers[ins.dst] = fetch(ins.lhs) + fetch(ins.rhs);
+                                break;
+                            case operation::sub:
+                                registers[ins.dst] = fetch(ins.lhs) - fetch(ins.rhs);
+                                break;
+                            case operation::mul:
+                                registers[ins.dst] = fetch(ins.lhs) * fetch(ins.rhs);
+                                break;
+                            case operation::pow:
+                                registers[ins.dst] = fetch(ins.lhs).pow(ins.rhs.index);
+                                break;
+                        }
+                    }
+                    return fetch(_result);
+                }
+
+                /**
+                 * Evaluates the expression at rows [0, rows), where columns[i][row] is the value
+                 * of variable i at the given row. Rows are split between threads under MULTICORE.
+                 */
+                template<typename Columns>
+                std::vector<value_type> evaluate_rows(const Columns &columns, std::size_t rows) const {
+                    std::vector<value_type> result(rows);
+
+#ifdef MULTICORE
+#pragma omp parallel
+#endif
+                    {
+                        std::vector<value_type> registers(_register_count);
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+                        for (std::size_t row = 0; row < rows; ++row) {
+                            result[row] = evaluate(
+                                [&columns, row](std::size_t variable) -> const value_type & {
+                                    return columns[variable][row];
+                                },
+                                registers);
+                        }
+                    }
+                    return result;
+                }
+
+                /**
+                 * Upper bound on the degree of the expression in the polynomial sense,
+                 * given the degree of each variable.
+                 */
+                template<typename GetVariableDegree>
+                std::size_t degree(GetVariableDegree &&get_variable_degree) const {
+                    std::vector<std::size_t> registers(_register_count);
+                    auto fetch = [&get_variable_degree, &registers](const operand &o) -> std::size_t {
+                        switch (o.kind) {
+                            case operand_kind::reg:
+                                return registers[o.index];
+                            case operand_kind::variable:
+                                return get_variable_degree(o.index);
+                            default:
+                                return 0;
+                        }
+                    };
+
+                    for (const instruction &ins : _instructions) {
+                        switch (ins.op) {
+                            case operation::add:
+                            case operation::sub:
+                                registers[ins.dst] = std::max(fetch(ins.lhs), fetch(ins.rhs));
+                                break;
+                            case operation::mul:
+                                registers[ins.dst] = fetch(ins.lhs) + fetch(ins.rhs);
+                                break;
+                            case operation::pow:
+                                registers[ins.dst] = fetch(ins.lhs) * ins.rhs.index;
+                                break;
+                        }
+                    }
+                    return fetch(_result);
+                }
+
+            private:
+                // Translates the expression tree into instructions writing to virtual registers,
+                // one per instruction. Identical subexpressions are emitted once.
+                class compiler : public boost::static_visitor<operand> {
+                public:
+                    compiler(compiled_expression &target) : target(target) {
+                    }
+
+                    operand compile(const math::expression<VariableType> &expr) {
+                        // Keyed by hash and node address rather than by expression, so that
+                        // the subtrees are not copied into the map.
+                        auto &bucket = _compiled[expr.get_hash()];
+                        for (const auto &[node, compiled] : bucket) {
+                            if (*node == expr) {
+                                return compiled;
+                            }
+                        }
+                        operand result = boost::apply_visitor(*this, expr.get_expr());
+                        _compiled[expr.get_hash()].emplace_back(&expr, result);
+                        return result;
+                    }
+
+                    operand operator()(const math::term<VariableType> &term) {
+                        const auto &vars = term.get_vars();
+                        if (vars.empty()) {
+                            return constant(term.get_coeff());
+                        }
+
+                        operand result = variable(vars[0]);
+                        for (std::size_t i = 1; i < vars.size(); ++i) {
+                            result = emit(operation::mul, result, variable(vars[i]));
+                        }
+                        if (term.get_coeff() != value_type::one()) {
+                            result = emit(operation::mul, constant(term.get_coeff()), result);
+                        }
+                        return result;
+                    }
+
+                    operand operator()(const math::pow_operation<VariableType> &pow) {
+                        operand base = compile(pow.get_expr());
+                        return emit(operation::pow, base,
+                                    operand {operand_kind::constant, static_cast<std::uint32_t>(pow.get_power())});
+                    }
+
+                    operand operator()(const math::binary_arithmetic_operation<VariableType> &op) {
+                        operand left = compile(op.get_expr_left());
+                        operand right = compile(op.get_expr_right());
+                        switch (op.get_op()) {
+                            case ArithmeticOperator::ADD:
+                                return emit(operation::add, left, right);
+                            case ArithmeticOperator::SUB:
+                                return emit(operation::sub, left, right);
+                            default:
+                                return emit(operation::mul, left, right);
+                        }
+                    }
+
+                private:
+                    operand emit(operation op, const operand &lhs, const operand &rhs) {
+                        std::uint32_t dst = static_cast<std::uint32_t>(target._instructions.size());
+                        target._instructions.push_back({op, dst, lhs, rhs});
+                        return {operand_kind::reg, dst};
+                    }
+
+                    operand variable(const VariableType &var) {
+                        auto it = _variable_numbers.find(var);
+                        if (it == _variable_numbers.end()) {
+                            it = _variable_numbers.emplace(var, target._variables.size()).first;
+                            target._variables.push_back(var);
+                        }
+                        return {operand_kind::variable, static_cast<std::uint32_t>(it->second)};
+                    }
+
+                    operand constant(const value_type &value) {
+                        target._constants.push_back(value);
+                        return {operand_kind::constant, static_cast<std::uint32_t>(target._constants.size() - 1)};
+                    }
+
+                    compiled_expression &target;
+                    std::unordered_map<std::size_t,
+                                       std::vector<std::pair<const math::expression<VariableType> *, operand>>>
+                        _compiled;
+                    std::unordered_map<VariableType, std::size_t> _variable_numbers;
+                };
+
+                // Maps virtual registers onto physical ones, reusing a register after the last read of its value.
+                void allocate_registers() {
+                    const std::size_t n = _instructions.size();
+                    std::vector<std::size_t> last_use(n, 0);
+                    auto note_use = [&last_use](const operand &o, std::size_t position) {
+                        if (o.kind == operand_kind::reg) {
+                            last_use[o.index] = position;
+                        }
+                    };
+                    for (std::size_t i = 0; i < n; ++i) {
+                        note_use(_instructions[i].lhs, i);
+                        if (_instructions[i].op != operation::pow) {
+                            note_use(_instructions[i].rhs, i);
+                        }
+                    }
+                    note_use(_result, n);
+
+                    std::vector<std::uint32_t> physical(n);
+                    std::vector<std::uint32_t> free_registers;
+                    _register_count = 0;
+                    auto rename = [&physical](operand &o) {
+                        if (o.kind == operand_kind::reg) {
+                            o.index = physical[o.index];
+                        }
+                    };
+                    auto release = [&last_use, &physical, &free_registers](const operand &o, std::size_t position) {
+                        if (o.kind == operand_kind::reg && last_use[o.index] == position) {
+                            free_registers.push_back(physical[o.index]);
+                        }
+                    };
+
+                    for (std::size_t i = 0; i < n; ++i) {
+                        instruction &ins = _instructions[i];
+                        // Operands are read before the destination is written, so a register
+                        // whose value dies here can hold the result.
+                        release(ins.lhs, i);
+                        if (ins.op != operation::pow && !(ins.rhs.kind == ins.lhs.kind && ins.rhs.index == ins.lhs.index)) {
+                            release(ins.rhs, i);
+                        }
+                        if (free_registers.empty()) {
+                            physical[i] = static_cast<std::uint32_t>(_register_count++);
+                        } else {
+                            physical[i] = free_registers.back();
+                            free_registers.pop_back();
+                        }
+
+                        rename(ins.lhs);
+                        if (ins.op != operation::pow) {
+                            rename(ins.rhs);
+                        }
+                        ins.dst = physical[i];
+                    }
+                    rename(_result);
+                }
+
+                std::vector<variable_type> _variables;
+                std::vector<value_type> _constants;
+                std::vector<instruction> _instructions;
+                operand _result;
+                std::size_t _register_count = 0;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_MATH_COMPILED_EXPRESSION_HPP
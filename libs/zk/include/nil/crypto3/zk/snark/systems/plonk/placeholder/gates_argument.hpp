@@ -51,6 +51,7 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -73,33 +74,35 @@ namespace nil {
 
                     constexpr static const std::size_t argument_size = 1;
 
-                    static inline void build_variable_value_map(
-                        const math::expression<polynomial_dfs_variable_type>& expr,
+                    // Values of the given variables on the extended domain, in the same order.
+                    // Columns already extended to this domain size are taken from extended_values,
+                    // the other ones are extended and added to it.
+                    static inline void build_column_values(
+                        const std::vector<variable_type> &variables,
                         const plonk_polynomial_dfs_table<FieldType> &assignments,
                         std::shared_ptr<math::evaluation_domain<FieldType>> domain,
                         std::size_t extended_domain_size,
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type>& variable_values_out) {
-
-                        std::unordered_map<polynomial_dfs_variable_type, size_t> variable_counts;
-
-                        math::expression_for_each_variable_visitor<polynomial_dfs_variable_type> visitor(
-                            [&variable_counts](const polynomial_dfs_variable_type& var) {
-                                variable_counts[var]++;
-                        });
-                        std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain =
-                            math::make_evaluation_domain<FieldType>(extended_domain_size);
-
-                        visitor.visit(expr);
-
-                        for (const auto& [var, count]: variable_counts) {
-                            // We may have variable values in required sizes in some cases.
-                            if (variable_values_out.find(var) != variable_values_out.end())
-                                continue;
-                            polynomial_dfs_type assignment = assignments.get_variable_value(var, domain); 
-                            if (count > 1) {
-                                assignment.resize(extended_domain_size, domain, extended_domain);
+                        std::unordered_map<variable_type, polynomial_dfs_type> &extended_values,
+                        std::vector<polynomial_dfs_type> &columns_out) {
+
+                        std::shared_ptr<math::evaluation_domain<FieldType>> extended_domain;
+
+                        columns_out.resize(variables.size());
+                        for (std::size_t i = 0; i < variables.size(); ++i) {
+                            const variable_type &var = variables[i];
+                            auto cached = extended_values.find(var);
+                            if (cached == extended_values.end()) {
+                                if (!extended_domain) {
+                                    extended_domain = math::make_evaluation_domain<FieldType>(extended_domain_size);
+                                }
+                                polynomial_dfs_type column = assignments.get_variable_value(
+                                    polynomial_dfs_variable_type(var.index, var.rotation, var.relative,
+                                        static_cast<typename polynomial_dfs_variable_type::column_type>(var.type)),
+                                    domain);
+                                column.resize(extended_domain_size, domain, extended_domain);
+                                cached = extended_values.emplace(var, std::move(column)).first;
                             }
-                            variable_values_out[var] = assignment;
+                            columns_out[i] = cached->second;
                         }
                     }
 
@@ -119,11 +122,6 @@ namespace nil {
                         ++max_gates_degree;
                         typename FieldType::value_type theta = transcript.template challenge<FieldType>();
 
-                        auto value_type_to_polynomial_dfs = [](
-                            const typename variable_type::assignment_type& coeff) {
-                                return polynomial_dfs_type(0, 1, coeff);
-                            };
-
                         std::vector<std::uint32_t> extended_domain_sizes;
                         std::vector<std::uint32_t> degree_limits;
                         std::uint32_t max_degree = std::pow(2, ceil(std::log2(max_gates_degree)));
@@ -134,25 +132,19 @@ namespace nil {
                         degree_limits.push_back(max_degree / 2);
                         extended_domain_sizes.push_back(max_domain_size / 2);
 
-                        std::vector<math::expression<polynomial_dfs_variable_type>> expressions(extended_domain_sizes.size());
+                        std::vector<math::expression<variable_type>> expressions(extended_domain_sizes.size());
 
                         auto theta_acc = FieldType::value_type::one();
 
-                        // Every constraint has variable type 'variable_type', but we want it to use
-                        // 'polynomial_dfs_variable_type' instead. The only difference is the coefficient type
-                        // inside a term. We want the coefficients to be dfs polynomials here.
-                        math::expression_variable_type_converter<variable_type, polynomial_dfs_variable_type> converter(
-                            value_type_to_polynomial_dfs);
-
                         math::expression_max_degree_visitor<variable_type> visitor;
 
                         const auto& gates = constraint_system.gates();
 
                         for (const auto& gate: gates) {
-                            std::vector<math::expression<polynomial_dfs_variable_type>> gate_results(extended_domain_sizes.size());
+                            std::vector<math::expression<variable_type>> gate_results(extended_domain_sizes.size());
 
                             for (const auto& constraint : gate.constraints) {
-                                auto next_term = converter.convert(constraint) * value_type_to_polynomial_dfs(theta_acc);
+                                auto next_term = constraint * theta_acc;
 
                                 theta_acc *= theta;
                                 // +1 stands for the selector multiplication.
@@ -166,8 +158,8 @@ namespace nil {
                                 }
                             }
 
-                            auto selector = polynomial_dfs_variable_type(
-                                gate.selector_index, 0, false, polynomial_dfs_variable_type::column_type::selector);
+                            auto selector = variable_type(
+                                gate.selector_index, 0, false, variable_type::column_type::selector);
 
                             for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
                                 gate_results[i] *= selector;
@@ -175,24 +167,29 @@ namespace nil {
                             }
                         }
 
-                        std::unordered_map<polynomial_dfs_variable_type, polynomial_dfs_type> variable_values;
+                        std::unordered_map<variable_type, polynomial_dfs_type> extended_values;
                         std::array<polynomial_dfs_type, argument_size> F;
 
                         for (size_t i = 0; i < extended_domain_sizes.size(); ++i) {
-                            if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i-1]) {
-                                variable_values.clear();
+                            if (i != 0 && extended_domain_sizes[i] != extended_domain_sizes[i - 1]) {
+                                extended_values.clear();
+                            }
+                            if (expressions[i].is_empty()) {
+                                continue;
                             }
-                            build_variable_value_map(expressions[i], column_polynomials, original_domain,
-                                extended_domain_sizes[i], variable_values);
 
-                            math::cached_expression_evaluator<polynomial_dfs_variable_type> evaluator(
-                                expressions[i], [&assignments=variable_values, domain_size=extended_domain_sizes[i]]
-                                (const polynomial_dfs_variable_type &var) -> const polynomial_dfs_type& {
-                                    return assignments[var];
-                                }
-                            );
+                            // Compiled once, then evaluated row by row over the extended domain, so that
+                            // no intermediate polynomials are materialized.
+                            math::compiled_expression<variable_type> compiled(expressions[i]);
+
+                            std::vector<polynomial_dfs_type> columns;
+                            build_column_values(compiled.variables(), column_polynomials, original_domain,
+                                extended_domain_sizes[i], extended_values, columns);
+
+                            std::size_t degree = compiled.degree(
+                                [&columns](std::size_t variable) { return columns[variable].degree(); });
 
-                            F[0] += evaluator.evaluate();
+                            F[0] += polynomial_dfs_type(degree, compiled.evaluate_rows(columns, extended_domain_sizes[i]));
                         }
 
                         F[0] *= mask_polynomial;
@@ -50,6 +50,10 @@
 #ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_VERIFIER_HPP
 #define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_ENCRYPTED_INPUT_VERIFIER_HPP
 
+#include <array>
+#include <utility>
+#include <vector>
+
 #include <nil/crypto3/zk/snark/systems/ppzksnark/r1cs_gg_ppzksnark/verifier.hpp>
 
 namespace nil {
@@ -92,58 +96,35 @@ namespace nil {
                         assert(ct_size - 2 == pubkey.delta_s_g1.size());
                         assert(ct_size - 2 == pubkey.t_g1.size());
                         assert(ct_size - 2 == pubkey.t_g2.size() - 1);
+                        typedef std::pair<typename g1_type::value_type, typename g2_type::value_type> pairing_argument_type;
+
                         typename g1_type::value_type acc = gg_vk.gamma_ABC_g1.first;
-                        typename gt_type::value_type sum_cipher = gt_type::value_type::one();
+                        // prod e(ct_i, t_i) == e(ct_last, g2) is checked as a single product with e(-ct_last, g2)
+                        std::vector<pairing_argument_type> cipher_pairs;
+                        cipher_pairs.reserve(ct_size);
 
                         auto it1 = first;
                         auto it2 = std::cbegin(pubkey.t_g2);
                         while (it1 != last - 1 && it2 != std::cend(pubkey.t_g2)) {
                             acc = acc + *it1;
-                            sum_cipher = sum_cipher * algebra::pair_reduced<CurveType>(*it1++, *it2++);
+                            cipher_pairs.emplace_back(*it1++, *it2++);
                         }
                         assert((it1 == last - 1) && (it2 == std::cend(pubkey.t_g2)));
 
                         for (std::size_t i = ct_size - 2; i < input_size; ++i) {
                             acc = acc + unencrypted_primary_input[i - ct_size + 2] * gg_vk.gamma_ABC_g1.rest[i];
                         }
-                        typename gt_type::value_type presum_cipher =
-                            algebra::pair_reduced<CurveType>(*(last - 1), g2_type::value_type::one());
-                        bool ans1 = (sum_cipher == presum_cipher);
-
-                        // TODO: optimize
-                        typename gt_type::value_type QAPl = algebra::pair_reduced<CurveType>(proof.g_A, proof.g_B);
-                        typename gt_type::value_type QAPr = gg_vk.alpha_g1_beta_g2 *
-                                                            algebra::pair_reduced<CurveType>(acc, gg_vk.gamma_g2) *
-                                                            algebra::pair_reduced<CurveType>(proof.g_C, gg_vk.delta_g2);
-                        // const g1_precomputed_type proof_g1_A_precomp = precompute_g1<CurveType>(proof.g_A);
-                        // const g2_precomputed_type proof_g2_B_precomp = precompute_g2<CurveType>(proof.g_B);
-                        //
-                        // const g1_precomputed_type pk_g1_alpha_precomp =
-                        //     precompute_g1<CurveType>(gg_keypair.first.alpha_g1);
-                        // const g2_precomputed_type pk_g2_beta_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.first.beta_g2);
-                        //
-                        // const g1_precomputed_type proof_g1_C_precomp = precompute_g1<CurveType>(proof.g_C);
-                        // const g2_precomputed_type vk_g2_delta_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.second.delta_g2);
-                        //
-                        // const g1_precomputed_type proof_g1_cn_precomp = precompute_g1<CurveType>(acc);
-                        // const g2_precomputed_type vk_g2_gamma_precomp =
-                        //     precompute_g2<CurveType>(gg_keypair.second.gamma_g2);
-                        //
-                        // typename gt_type::value_type QAPl_1 =
-                        //     miller_loop<CurveType>(proof_g1_A_precomp, proof_g2_B_precomp);
-                        // typename gt_type::value_type QAPl_2 = double_miller_loop<CurveType>(
-                        //     proof_g1_C_precomp, vk_g2_delta_precomp, pk_g1_alpha_precomp, pk_g2_beta_precomp);
-                        //
-                        // typename gt_type::value_type QAPr_2 =
-                        //     miller_loop<CurveType>(proof_g1_cn_precomp, vk_g2_gamma_precomp);
-                        //
-                        // typename gt_type::value_type QAPl = final_exponentiation<CurveType>(QAPl_1 *
-                        // QAPl_2.inversed()); typename gt_type::value_type QAPr =
-                        // final_exponentiation<CurveType>(QAPr_2);
+                        cipher_pairs.emplace_back(-*(last - 1), g2_type::value_type::one());
+                        bool ans1 = (algebra::multi_pair_reduced<CurveType>(cipher_pairs.begin(), cipher_pairs.end()) ==
+                                     gt_type::value_type::one());
 
-                        bool ans2 = (QAPl == QAPr);
+                        // e(A, B) * e(-acc, gamma) * e(-C, delta) == e(alpha, beta)
+                        const std::array<pairing_argument_type, 3> proof_pairs = {
+                            pairing_argument_type(proof.g_A, proof.g_B),
+                            pairing_argument_type(-acc, gg_vk.gamma_g2),
+                            pairing_argument_type(-proof.g_C, gg_vk.delta_g2)};
+                        bool ans2 = (algebra::multi_pair_reduced<CurveType>(proof_pairs.begin(), proof_pairs.end()) ==
+                                     gg_vk.alpha_g1_beta_g2);
 
                         return (ans1 && ans2);
                     }
@@ -106,7 +106,7 @@ namespace nil {
                                                        qap_wit.coefficients_for_ABCs.end());
 
                         typename g1_type::value_type evaluation_At =
-                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.A_query.begin(),
                                         proving_key.A_query.begin() + qap_wit.num_variables + 1,
                                         const_padded_assignment.begin(),
@@ -114,7 +114,7 @@ namespace nil {
                                         chunks);
 
                         typename commitments::knowledge_commitment<g2_type, g1_type>::value_type evaluation_Bt =
-                                commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                commitments::kc_multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.B_query,
                                         0,
                                         qap_wit.num_variables + 1,
@@ -123,7 +123,7 @@ namespace nil {
                                         chunks);
 
                         typename g1_type::value_type evaluation_Ht =
-                                algebra::multiexp<algebra::policies::multiexp_method_BDLO12>(
+                                algebra::multiexp<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.H_query.begin(),
                                         proving_key.H_query.begin() + (qap_wit.degree - 1),
                                         qap_wit.coefficients_for_H.begin(),
@@ -131,7 +131,7 @@ namespace nil {
                                         chunks);
 
                         typename g1_type::value_type evaluation_Lt =
-                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_BDLO12>(
+                                algebra::multiexp_with_mixed_addition<algebra::policies::multiexp_method_pippenger>(
                                         proving_key.L_query.begin(),
                                         proving_key.L_query.end(),
                                         const_padded_assignment.begin() + qap_wit.num_inputs + 1,
@@ -50,6 +50,9 @@
 #ifndef CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 #define CRYPTO3_ZK_R1CS_GG_PPZKSNARK_BASIC_VERIFIER_HPP
 
+#include <array>
+#include <utility>
+
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 
 #include <nil/crypto3/container/accumulation_vector.hpp>
@@ -167,16 +170,18 @@ namespace nil {
 
                         const g1_precomputed_type proof_g_A_precomp = precompute_g1<CurveType>(proof.g_A);
                         const g2_precomputed_type proof_g_B_precomp = precompute_g2<CurveType>(proof.g_B);
-                        const g1_precomputed_type proof_g_C_precomp = precompute_g1<CurveType>(proof.g_C);
-                        const g1_precomputed_type acc_precomp = precompute_g1<CurveType>(acc);
-
-                        const typename gt_type::value_type QAP1 =
-                            miller_loop<CurveType>(proof_g_A_precomp, proof_g_B_precomp);
-                        const typename gt_type::value_type QAP2 = double_miller_loop<CurveType>(
-                            acc_precomp, processed_verification_key.vk_gamma_g2_precomp, proof_g_C_precomp,
-                            processed_verification_key.vk_delta_g2_precomp);
+                        const g1_precomputed_type proof_g_C_precomp = precompute_g1<CurveType>(-proof.g_C);
+                        const g1_precomputed_type acc_precomp = precompute_g1<CurveType>(-acc);
+
+                        // e(A, B) * e(-acc, gamma) * e(-C, delta) in a single Miller loop
+                        typedef std::pair<const g1_precomputed_type &, const g2_precomputed_type &> precomputed_pair;
+                        const std::array<precomputed_pair, 3> pairs = {
+                            precomputed_pair(proof_g_A_precomp, proof_g_B_precomp),
+                            precomputed_pair(acc_precomp, processed_verification_key.vk_gamma_g2_precomp),
+                            precomputed_pair(proof_g_C_precomp, processed_verification_key.vk_delta_g2_precomp)};
+
                         const typename gt_type::value_type QAP =
-                            final_exponentiation<CurveType>(QAP1 * QAP2.unitary_inversed());
+                            final_exponentiation<CurveType>(multi_miller_loop<CurveType>(pairs.begin(), pairs.end()));
 
                         if (QAP != processed_verification_key.vk_alpha_g1_beta_g2) {
                             result = false;
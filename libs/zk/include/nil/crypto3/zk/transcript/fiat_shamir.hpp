@@ -36,6 +36,7 @@
 #include <nil/crypto3/hash/keccak.hpp>
 #include <nil/crypto3/hash/poseidon.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/stream_hasher.hpp>
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/detail/poseidon/poseidon_sponge.hpp>
@@ -134,34 +135,30 @@ namespace nil {
 
                     typedef typename boost::multiprecision::cpp_int_modular_backend<hash_type::digest_bits>
                     modular_backend_of_hash_size;
+                    typedef hashes::stream_hasher<hash_type> midstate_type;
 
-                    fiat_shamir_heuristic_sequential() : state(hash<hash_type>({0})) {
+                    fiat_shamir_heuristic_sequential() : state(hashes::hash_once<hash_type>({0})) {
                     }
 
                     template<typename InputRange>
-                    fiat_shamir_heuristic_sequential(const InputRange &r) : state(hash<hash_type>(r)) {
+                    fiat_shamir_heuristic_sequential(const InputRange &r) : state(hashes::hash_once<hash_type>(r)) {
                     }
 
                     template<typename InputIterator>
                     fiat_shamir_heuristic_sequential(InputIterator first, InputIterator last) : state(
-                        hash<hash_type>(first, last)) {
+                        hashes::hash_once<hash_type>(first, last)) {
                     }
 
                     template<typename InputRange>
                     typename std::enable_if_t<!algebra::is_group_element<InputRange>::value &&
                                               !algebra::is_field_element<InputRange>::value>
                     operator()(const InputRange &r) {
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(r, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        state = midstate().update(r).finalize();
                     }
 
                     template<typename InputIterator>
                     void operator()(InputIterator first, InputIterator last) {
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(first, last,
-                                            static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        state = midstate().update(first, last).finalize();
                     }
 
                     template<typename element>
@@ -172,9 +169,38 @@ namespace nil {
                         std::vector<std::uint8_t> byte_data =
                                 nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
                         BOOST_ASSERT(status == nil::marshalling::status_type::success);
-                        auto acc_convertible = hash<hash_type>(state);
-                        state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                        state = midstate().update(byte_data).finalize();
+                    }
+
+                    /*!
+                     * @brief Hash state with the current transcript state already absorbed. Absorbing data on top
+                     * of it with absorb() is equivalent to operator(). The state is a single digest, shorter than a
+                     * block, so it is only buffered: reusing a midstate avoids feeding the state again, not a
+                     * compression.
+                     */
+                    midstate_type midstate() const {
+                        midstate_type hasher;
+                        hasher.update(state);
+                        return hasher;
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<!algebra::is_group_element<InputRange>::value &&
+                                              !algebra::is_field_element<InputRange>::value>
+                    absorb(const midstate_type &midstate, const InputRange &r) {
+                        midstate_type hasher = midstate;
+                        state = hasher.update(r).finalize();
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<algebra::is_group_element<element>::value ||
+                                              algebra::is_field_element<element>::value>
+                    absorb(const midstate_type &midstate, element const &data) {
+                        nil::marshalling::status_type status;
+                        std::vector<std::uint8_t> byte_data =
+                                nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
+                        BOOST_ASSERT(status == nil::marshalling::status_type::success);
+                        absorb(midstate, byte_data);
                     }
 
                     template<typename FieldType>
@@ -187,7 +213,7 @@ namespace nil {
                                                          (FieldType::number_bits % digest_value_bits == 0 ? 0 : 1);
 
                         std::array<digest_value_type, element_size> data;
-                        state = hash<hash_type>(state);
+                        state = hashes::hash_once<hash_type>(state);
 
                         std::size_t count = std::min(data.size(), state.size());
                         std::copy(state.begin(), state.begin() + count, data.begin() + data.size() - count);
@@ -214,7 +240,7 @@ namespace nil {
                                         hashes::uniformity_count::nonuniform_count,
                                         hashes::expand_msg_variant::rfc_xmd>>;
 
-                        typename h2f_type::digest_type result = hash<h2f_type>(state);
+                        typename h2f_type::digest_type result = hashes::hash_once<h2f_type>(state);
                         nil::marshalling::status_type status;
                         std::vector<std::uint8_t> byte_data =
                                 nil::marshalling::pack<nil::marshalling::option::big_endian>(result[0], status);
@@ -227,7 +253,7 @@ namespace nil {
 
                     template<typename Integral>
                     Integral int_challenge() {
-                        state = hash<hash_type>(state);
+                        state = hashes::hash_once<hash_type>(state);
                         nil::marshalling::status_type status;
                         boost::multiprecision::number<modular_backend_of_hash_size> raw_result =
                                 nil::marshalling::pack(state, status);
@@ -275,6 +301,7 @@ namespace nil {
                     using poseidon_policy = nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>;
                     using permutation_type = nil::crypto3::hashes::detail::poseidon_permutation<poseidon_policy>;
                     using state_type = typename permutation_type::state_type;
+                    using midstate_type = hashes::detail::poseidon_sponge_construction_custom<typename HashType::policy_type>;
 
                     fiat_shamir_heuristic_sequential() {
                     }
@@ -314,6 +341,16 @@ namespace nil {
                         sponge.absorb(hash<hash_type>(first, last));
                     }
 
+                    midstate_type midstate() const {
+                        return sponge;
+                    }
+
+                    template<typename T>
+                    void absorb(const midstate_type &midstate, const T &data) {
+                        sponge = midstate;
+                        (*this)(data);
+                    }
+
                     template<typename FieldType>
                     typename FieldType::value_type challenge() {
                         typename FieldType::value_type result = sponge.squeeze();
@@ -352,7 +389,7 @@ namespace nil {
                     }
 
                 public:
-                    hashes::detail::poseidon_sponge_construction_custom<typename HashType::policy_type> sponge;
+                    midstate_type sponge;
                 };
             } // namespace transcript
         } // namespace zk
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE curve_element_batch_reading_test
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::marshalling;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+/*
+ * Decoding 2^log_size compressed points: reading the array_list point by point, against the batched reader
+ * without subgroup checks, with one check per point and with one randomized check of the whole batch.
+ */
+template<typename GroupType>
+void print_curve_element_batch_reading_csv(std::size_t log_size) {
+    typedef nil::marshalling::option::big_endian endianness;
+    typedef typename GroupType::value_type group_value_type;
+    typedef decltype(types::fill_curve_element_vector<GroupType, endianness>({})) curve_element_vector_type;
+
+    const std::size_t size = std::size_t(1) << log_size;
+    std::vector<group_value_type> points;
+    for (std::size_t i = 0; i < size; ++i) {
+        points.push_back(algebra::random_element<GroupType>());
+    }
+    auto filled = types::fill_curve_element_vector<GroupType, endianness>(points);
+    std::vector<unsigned char> blob(filled.length());
+    auto write_iter = blob.begin();
+    BOOST_CHECK(filled.write(write_iter, blob.size()) == nil::marshalling::status_type::success);
+
+    printf("%ld", log_size);
+    fflush(stdout);
+
+    long long start_time = get_nsec_time();
+    {
+        curve_element_vector_type read_val;
+        auto read_iter = blob.cbegin();
+        BOOST_CHECK(read_val.read(read_iter, blob.size()) == nil::marshalling::status_type::success);
+        BOOST_CHECK(types::make_curve_element_vector<GroupType, endianness>(read_val) == points);
+    }
+    printf("\t%lld", get_nsec_time() - start_time);
+    fflush(stdout);
+
+    for (processing::subgroup_check_mode check :
+         {processing::subgroup_check_mode::none, processing::subgroup_check_mode::individual,
+          processing::subgroup_check_mode::batched}) {
+        start_time = get_nsec_time();
+        std::vector<group_value_type> result;
+        auto read_iter = blob.cbegin();
+        BOOST_CHECK(types::read_curve_element_vector<GroupType, endianness>(result, read_iter, blob.size(),
+                                                                            check) ==
+                    nil::marshalling::status_type::success);
+        printf("\t%lld", get_nsec_time() - start_time);
+        fflush(stdout);
+        BOOST_CHECK(result == points);
+    }
+    printf("\n");
+}
+
+BOOST_AUTO_TEST_SUITE(curve_element_batch_reading_test_suite)
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reading_bls12_381_g1) {
+    printf("log_size\tarray_list\tbatch_no_check\tbatch_individual_check\tbatch_randomized_check\n");
+    for (std::size_t log_size = 8; log_size <= 12; log_size += 2) {
+        print_curve_element_batch_reading_csv<algebra::curves::bls12<381>::g1_type<>>(log_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reading_bls12_381_g2) {
+    printf("log_size\tarray_list\tbatch_no_check\tbatch_individual_check\tbatch_randomized_check\n");
+    for (std::size_t log_size = 8; log_size <= 12; log_size += 2) {
+        print_curve_element_batch_reading_csv<algebra::curves::bls12<381>::g2_type<>>(log_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reading_bn254_g1) {
+    printf("log_size\tarray_list\tbatch_no_check\tbatch_individual_check\tbatch_randomized_check\n");
+    for (std::size_t log_size = 8; log_size <= 12; log_size += 2) {
+        print_curve_element_batch_reading_csv<algebra::curves::alt_bn128<254>::g1_type<>>(log_size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(curve_element_batch_reading_bn254_g2) {
+    printf("log_size\tarray_list\tbatch_no_check\tbatch_individual_check\tbatch_randomized_check\n");
+    for (std::size_t log_size = 8; log_size <= 12; log_size += 2) {
+        print_curve_element_batch_reading_csv<algebra::curves::alt_bn128<254>::g2_type<>>(log_size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE raw_key_loading_test
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/marshalling/endianness.hpp>
+#include <nil/marshalling/field_type.hpp>
+#include <nil/marshalling/status_type.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/marshalling/algebra/types/fast_curve_element.hpp>
+#include <nil/crypto3/marshalling/algebra/types/raw_element_container.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::marshalling;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+/*
+ * Startup time of a prover holding a key of 2^log_size G1 points: unpacking the fast_curve_element format
+ * into group elements, against mapping the raw element container with and without checksum verification.
+ * Generating random points is expensive, so a single one is repeated.
+ */
+template<typename GroupType>
+void print_raw_key_loading_csv(std::size_t log_size) {
+    typedef nil::marshalling::option::big_endian endianness;
+    typedef typename GroupType::value_type group_value_type;
+    typedef decltype(std::declval<group_value_type>().to_affine()) affine_value_type;
+
+    const std::size_t size = std::size_t(1) << log_size;
+    const group_value_type point = algebra::random_element<GroupType>();
+
+    // Existing format
+    auto filled = types::fill_fast_curve_element_vector<GroupType, endianness>({point});
+    const auto filled_point = filled.value().front();
+    filled.value().resize(size, filled_point);
+    std::vector<unsigned char> blob(filled.length());
+    auto write_iter = blob.begin();
+    BOOST_CHECK(filled.write(write_iter, blob.size()) == nil::marshalling::status_type::success);
+    filled.value().clear();
+    filled.value().shrink_to_fit();
+
+    // Raw format
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "crypto3_raw_key_loading.raw").string();
+    {
+        types::raw_container_writer writer;
+        writer.add(std::vector<affine_value_type>(size, point.to_affine()));
+        std::ofstream out(path, std::ios::binary);
+        BOOST_CHECK(writer.write(out) == nil::marshalling::status_type::success);
+    }
+
+    printf("%ld", log_size);
+    fflush(stdout);
+
+    long long start_time = get_nsec_time();
+    {
+        decltype(filled) read_val;
+        auto read_iter = blob.cbegin();
+        BOOST_CHECK(read_val.read(read_iter, blob.size()) == nil::marshalling::status_type::success);
+        std::vector<group_value_type> key = types::make_fast_curve_element_vector<GroupType, endianness>(read_val);
+        BOOST_CHECK_EQUAL(key.size(), size);
+    }
+    printf("\t%lld", get_nsec_time() - start_time);
+    fflush(stdout);
+
+    for (bool verify_checksums : {false, true}) {
+        start_time = get_nsec_time();
+        nil::marshalling::status_type status;
+        types::mapped_raw_container container(path, status, verify_checksums);
+        auto key = container.template section<affine_value_type>(0, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        BOOST_CHECK_EQUAL(std::size_t(key.size()), size);
+        printf("\t%lld", get_nsec_time() - start_time);
+        fflush(stdout);
+    }
+    printf("\n");
+
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE(raw_key_loading_test_suite)
+
+BOOST_AUTO_TEST_CASE(raw_key_loading_bls12_381_g1) {
+    printf("log_size\tfast_curve_element\traw_mapped\traw_mapped_checksum\n");
+    print_raw_key_loading_csv<algebra::curves::bls12<381>::g1_type<>>(22);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,7 @@
 #define BOOST_TEST_MODULE kzg_test
 
 #include <string>
+#include <thread>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -174,7 +175,7 @@ BOOST_AUTO_TEST_SUITE(kzg_test_suite)
         BOOST_CHECK(zk::algorithms::verify_eval<kzg_type>(params, proof, pk));
 
         // wrong params
-        auto ck2 = params.commitment_key;
+        typename kzg_type::single_commitment_type ck2 = params.commitment_key;
         ck2[0] = ck2[0] * 2;
         auto params2 = kzg_type::params_type(ck2, params.verification_key * 2u);
         BOOST_CHECK(!zk::algorithms::verify_eval<kzg_type>(params2, proof, pk));
@@ -253,6 +254,42 @@ BOOST_AUTO_TEST_SUITE(kzg_test_suite)
         BOOST_CHECK(zk::algorithms::verify_eval<kzg_type>(params, proof, pk));
     }
 
+    BOOST_AUTO_TEST_CASE(kzg_shared_params_test) {
+
+        typedef algebra::curves::bls12<381> curve_type;
+        typedef typename curve_type::scalar_field_type::value_type scalar_value_type;
+
+        typedef zk::commitments::kzg<curve_type> kzg_type;
+
+        std::size_t n = 64;
+        const polynomial<scalar_value_type> f = {7u, 1u, 2u, 3u, 5u, 8u, 13u};
+
+        auto params = typename kzg_type::params_type(n);
+        auto params_copy = params;
+        BOOST_CHECK(params_copy.commitment_key.shares_points_with(params.commitment_key));
+        BOOST_CHECK(typename kzg_type::params_type(params.commitment_key, params.verification_key)
+                        .commitment_key.shares_points_with(params.commitment_key));
+
+        // Several provers open the same commitment at once with one key.
+        auto commit = zk::algorithms::commit<kzg_type>(params, f);
+        std::vector<scalar_value_type> points = {2u, 3u, 5u, 7u};
+        std::vector<typename kzg_type::proof_type> proofs(points.size());
+        std::vector<std::thread> provers;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            provers.emplace_back([&, i]() {
+                proofs[i] = zk::algorithms::proof_eval<kzg_type>(params, f, points[i]);
+            });
+        }
+        for (auto &prover : provers) {
+            prover.join();
+        }
+
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            typename kzg_type::public_key_type pk = {commit, points[i], f.evaluate(points[i])};
+            BOOST_CHECK(zk::algorithms::verify_eval<kzg_type>(params_copy, proofs[i], pk));
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(batched_kzg_test_suite)
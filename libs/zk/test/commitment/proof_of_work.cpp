@@ -26,6 +26,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/pallas/scalar_field.hpp>
 #include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
@@ -94,4 +96,53 @@ BOOST_AUTO_TEST_SUITE(proof_of_knowledge_test_suite)
         BOOST_ASSERT(!hard_pow_type::verify(old_transcript_1, result, grinding_bits));
     }
 
+    BOOST_AUTO_TEST_CASE(pow_grind_deterministic_test) {
+        using keccak = nil::crypto3::hashes::keccak_1600<256>;
+        using pow_type = nil::crypto3::zk::commitments::proof_of_work<keccak, std::uint32_t>;
+
+        const std::size_t grinding_bits = 12;
+        std::vector<std::uint8_t> init_blob {0x5e, 0xed};
+        nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<keccak> transcript(init_blob);
+        auto old_transcript_1 = transcript, old_transcript_2 = transcript;
+
+        auto first = pow_type::grind(transcript, grinding_bits);
+        auto second = pow_type::grind(transcript, grinding_bits);
+        BOOST_CHECK_EQUAL(first.proof_of_work, second.proof_of_work);
+        BOOST_CHECK(first.attempts > first.proof_of_work);
+
+        // grind() returns the smallest valid nonce
+        for (std::uint32_t nonce = 0; nonce < first.proof_of_work; ++nonce) {
+            auto tmp_transcript = old_transcript_2;
+            BOOST_CHECK(!pow_type::verify(tmp_transcript, nonce, grinding_bits));
+        }
+
+        auto result = pow_type::generate(transcript, grinding_bits);
+        BOOST_CHECK_EQUAL(result, first.proof_of_work);
+        BOOST_CHECK(pow_type::verify(old_transcript_1, result, grinding_bits));
+
+        // generate() leaves the transcript in the same state as verify()
+        BOOST_CHECK_EQUAL(transcript.template int_challenge<std::uint32_t>(),
+                          old_transcript_1.template int_challenge<std::uint32_t>());
+    }
+
+    BOOST_AUTO_TEST_CASE(pow_field_grind_deterministic_test) {
+        using curve_type = curves::pallas;
+        using field_type = curve_type::base_field_type;
+        using policy = nil::crypto3::hashes::detail::mina_poseidon_policy<field_type>;
+        using poseidon = nil::crypto3::hashes::poseidon<policy>;
+        using pow_type = nil::crypto3::zk::commitments::field_proof_of_work<poseidon, field_type>;
+
+        const std::size_t grinding_bits = 8;
+        nil::crypto3::zk::transcript::fiat_shamir_heuristic_sequential<poseidon> transcript;
+        auto old_transcript = transcript;
+
+        auto first = pow_type::grind(transcript, grinding_bits);
+        auto second = pow_type::grind(transcript, grinding_bits);
+        BOOST_CHECK(first.proof_of_work == second.proof_of_work);
+
+        auto result = pow_type::generate(transcript, grinding_bits);
+        BOOST_CHECK(result == first.proof_of_work);
+        BOOST_CHECK(pow_type::verify(old_transcript, result, grinding_bits));
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
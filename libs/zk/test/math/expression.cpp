@@ -28,6 +28,8 @@
 #include <random>
 #include <iostream>
 #include <set>
+#include <vector>
+#include <algorithm>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -39,6 +41,7 @@
 #include <nil/crypto3/zk/math/expression.hpp>
 #include <nil/crypto3/zk/math/expression_visitors.hpp>
 #include <nil/crypto3/zk/math/expression_evaluator.hpp>
+#include <nil/crypto3/zk/math/compiled_expression.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
 
 using namespace nil::crypto3;
@@ -158,4 +161,52 @@ BOOST_AUTO_TEST_CASE(expression_for_each_variable_visitor_test) {
         expected_rotations.begin(), expected_rotations.end());
 }
 
+BOOST_AUTO_TEST_CASE(compiled_expression_test) {
+
+    // setup
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using variable_type = typename nil::crypto3::zk::snark::plonk_variable<typename FieldType::value_type>;
+    using value_type = typename variable_type::assignment_type;
+
+    variable_type w0(0, 0, variable_type::column_type::witness);
+    variable_type w1(3, -1, variable_type::column_type::public_input);
+    variable_type w2(4, 1, variable_type::column_type::public_input);
+    variable_type w3(6, 2, variable_type::column_type::constant);
+
+    expression<variable_type> shared = (w0 + w1) * (w2 + w3);
+    expression<variable_type> expr;
+    for (std::size_t i = 1; i <= 20; ++i) {
+        expr += (shared - w0 * w1 * value_type(i)).pow(2) * w3 + shared * value_type(3);
+    }
+
+    compiled_expression<variable_type> compiled(expr);
+    BOOST_CHECK_EQUAL(compiled.variables().size(), 4);
+    // The repeated subexpressions are compiled once and evaluated in a few registers.
+    BOOST_CHECK(compiled.register_count() < 10);
+
+    const std::size_t rows = 64;
+    std::vector<std::vector<value_type>> columns(compiled.variables().size(), std::vector<value_type>(rows));
+    std::mt19937 gen(1);
+    for (auto &column : columns) {
+        for (auto &value : column) {
+            value = value_type(gen());
+        }
+    }
+
+    std::vector<value_type> result = compiled.evaluate_rows(columns, rows);
+    for (std::size_t row = 0; row < rows; ++row) {
+        expression_evaluator<variable_type> evaluator(
+            expr,
+            [&compiled, &columns, row](const variable_type &var) -> const value_type & {
+                const auto &vars = compiled.variables();
+                return columns[std::find(vars.begin(), vars.end(), var) - vars.begin()][row];
+            }
+        );
+        BOOST_CHECK(result[row] == evaluator.evaluate());
+    }
+
+    BOOST_CHECK_EQUAL(compiled.degree([](std::size_t) { return 1; }), 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()